@@ -0,0 +1,198 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace my_container {
+
+// Монотонная арена: память только выделяется, освобождается целиком через reset()/release().
+// Не потокобезопасна.
+class Arena {
+private:
+    struct alignas(std::max_align_t) Block {
+        Block* next;
+        size_t size;
+    };
+
+    Block* head_ = nullptr;
+    std::byte* cursor_ = nullptr;
+    std::byte* limit_ = nullptr;
+    size_t next_block_size_;
+
+    static std::byte* block_begin(Block* block) noexcept {
+        return reinterpret_cast<std::byte*>(block + 1);
+    }
+
+    void add_block(size_t min_size) {
+        size_t size = std::max(next_block_size_, min_size);
+        Block* block = static_cast<Block*>(::operator new(sizeof(Block) + size));
+        block->next = head_;
+        block->size = size;
+        head_ = block;
+        cursor_ = block_begin(block);
+        limit_ = cursor_ + size;
+        next_block_size_ = size * 2;
+    }
+
+public:
+    explicit Arena(size_t initial_block_size = 4096) : next_block_size_(std::max<size_t>(initial_block_size, 64)) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena() {
+        release();
+    }
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        auto aligned = [&]() {
+            auto address = reinterpret_cast<std::uintptr_t>(cursor_);
+            return reinterpret_cast<std::byte*>((address + alignment - 1) & ~(alignment - 1));
+        };
+        std::byte* result = cursor_ ? aligned() : nullptr;
+        if (!result || result + bytes > limit_) {
+            add_block(bytes + alignment);
+            result = aligned();
+        }
+        cursor_ = result + bytes;
+        return result;
+    }
+
+    // Оставляет самый большой (последний) блок и перематывает его в начало
+    void reset() noexcept {
+        if (!head_) return;
+        Block* keep = head_;
+        Block* block = keep->next;
+        while (block) {
+            Block* next = block->next;
+            ::operator delete(block);
+            block = next;
+        }
+        keep->next = nullptr;
+        cursor_ = block_begin(keep);
+        limit_ = cursor_ + keep->size;
+    }
+
+    void release() noexcept {
+        while (head_) {
+            Block* next = head_->next;
+            ::operator delete(head_);
+            head_ = next;
+        }
+        cursor_ = limit_ = nullptr;
+    }
+
+    size_t bytes_reserved() const noexcept {
+        size_t total = 0;
+        for (Block* block = head_; block; block = block->next) total += block->size;
+        return total;
+    }
+};
+
+// Пул свободных списков по классам размеров поверх арены; крупные запросы идут в operator new.
+// Не потокобезопасен.
+class Pool {
+private:
+    static constexpr size_t granularity = 16;
+    static constexpr size_t max_pooled = 512;
+    static constexpr size_t class_count = max_pooled / granularity;
+
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    FreeNode* free_[class_count] = {};
+    Arena arena_;
+
+    static bool pooled(size_t bytes, size_t alignment) noexcept {
+        return bytes <= max_pooled && alignment <= alignof(std::max_align_t);
+    }
+
+    static size_t size_class(size_t bytes) noexcept {
+        return bytes == 0 ? 0 : (bytes - 1) / granularity;
+    }
+
+public:
+    explicit Pool(size_t initial_block_size = 4096) : arena_(initial_block_size) {}
+
+    Pool(const Pool&) = delete;
+    Pool& operator=(const Pool&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        if (!pooled(bytes, alignment)) return ::operator new(bytes, std::align_val_t(alignment));
+        size_t cls = size_class(bytes);
+        if (FreeNode* node = free_[cls]) {
+            free_[cls] = node->next;
+            return node;
+        }
+        return arena_.allocate((cls + 1) * granularity, alignof(std::max_align_t));
+    }
+
+    void deallocate(void* ptr, size_t bytes, size_t alignment = alignof(std::max_align_t)) noexcept {
+        if (!ptr) return;
+        if (!pooled(bytes, alignment)) {
+            ::operator delete(ptr, std::align_val_t(alignment));
+            return;
+        }
+        size_t cls = size_class(bytes);
+        free_[cls] = ::new (ptr) FreeNode{free_[cls]};
+    }
+
+    // Возвращает всю память пула разом; выделенные ранее блоки становятся недействительными
+    void release() noexcept {
+        std::fill(std::begin(free_), std::end(free_), nullptr);
+        arena_.reset();
+    }
+};
+
+template <typename T, typename Resource>
+class ResourceAllocator {
+private:
+    Resource* resource_;
+
+    template <typename, typename>
+    friend class ResourceAllocator;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    explicit ResourceAllocator(Resource& resource) noexcept : resource_(&resource) {}
+
+    template <typename U>
+    ResourceAllocator(const ResourceAllocator<U, Resource>& other) noexcept : resource_(other.resource_) {}
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        if constexpr (requires { resource_->deallocate(ptr, n * sizeof(T), alignof(T)); }) {
+            resource_->deallocate(ptr, n * sizeof(T), alignof(T));
+        }
+    }
+
+    Resource& resource() const noexcept {
+        return *resource_;
+    }
+
+    template <typename U>
+    bool operator==(const ResourceAllocator<U, Resource>& other) const noexcept {
+        return resource_ == other.resource_;
+    }
+};
+
+template <typename T>
+using ArenaAllocator = ResourceAllocator<T, Arena>;
+
+template <typename T>
+using PoolAllocator = ResourceAllocator<T, Pool>;
+
+}  // namespace my_container
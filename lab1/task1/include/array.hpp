@@ -150,6 +150,7 @@
 #include <cstddef>
 #include <stdexcept>
 #include "container.hpp"
+#include "simd-compare.hpp"
 
 namespace my_container {
 
@@ -271,7 +272,11 @@ public:
     bool operator==(const Container<T, N>& other) const override {
         const Array* otherArray = dynamic_cast<const Array*>(&other);
         if (!otherArray) return false;
-        return std::equal(data_, data_ + N, otherArray->data_);
+        if constexpr (simd::Comparable<T>) {
+            return simd::equal(data_, otherArray->data_, N);
+        } else {
+            return std::equal(data_, data_ + N, otherArray->data_);
+        }
     }
 
     bool operator!=(const Container<T, N>& other) const override {
@@ -295,7 +300,11 @@ public:
     }
     
     auto operator<=>(const Array& other) const {
-        return std::lexicographical_compare_three_way(this->begin(), this->end(), other.begin(), other.end());
+        if constexpr (simd::Comparable<T>) {
+            return simd::compare_three_way(data_, N, other.data_, N);
+        } else {
+            return std::lexicographical_compare_three_way(this->begin(), this->end(), other.begin(), other.end());
+        }
     }
 };
 
@@ -37,18 +37,19 @@
 
 namespace my_container {
 
-template <typename T, size_t N>
+// Непрерывные контейнеры итерируются указателями; узловые подставляют свои типы итераторов
+template <typename T, size_t N, typename Iterator = T*, typename ConstIterator = const T*>
 class Container {
 public:
     virtual ~Container() = default;
     virtual Container& operator=(const Container& other) = 0;
 
-    virtual T* begin() = 0;
-    virtual const T* begin() const = 0;
-    virtual const T* cbegin() const = 0;
-    virtual T* end() = 0;
-    virtual const T* end() const = 0;
-    virtual const T* cend() const = 0;
+    virtual Iterator begin() = 0;
+    virtual ConstIterator begin() const = 0;
+    virtual ConstIterator cbegin() const = 0;
+    virtual Iterator end() = 0;
+    virtual ConstIterator end() const = 0;
+    virtual ConstIterator cend() const = 0;
 
     virtual bool operator==(const Container& other) const = 0;
     virtual bool operator!=(const Container& other) const = 0;
@@ -0,0 +1,109 @@
+#pragma once
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MY_CONTAINER_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace my_container::simd {
+
+// Целые сравниваются побайтно, float/double — по линиям (NaN != NaN, +0 == -0)
+template <typename T>
+concept Comparable = std::integral<T> || std::same_as<T, float> || std::same_as<T, double>;
+
+namespace detail {
+
+template <typename T>
+size_t mismatch_scalar(const T* a, const T* b, size_t n) {
+    size_t i = 0;
+    while (i < n && a[i] == b[i]) ++i;
+    return i;
+}
+
+#ifdef MY_CONTAINER_SIMD_X86
+
+template <typename T>
+size_t mismatch_sse2(const T* a, const T* b, size_t n) {
+    constexpr size_t lanes = 16 / sizeof(T);
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        unsigned diff;
+        if constexpr (std::same_as<T, float>) {
+            diff = ~_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i))) & 0xFu;
+        } else if constexpr (std::same_as<T, double>) {
+            diff = ~_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i))) & 0x3u;
+        } else {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            diff = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb))) & 0xFFFFu;
+        }
+        if (diff) {
+            size_t lane = static_cast<size_t>(__builtin_ctz(diff));
+            return i + (std::integral<T> ? lane / sizeof(T) : lane);
+        }
+    }
+    return i + mismatch_scalar(a + i, b + i, n - i);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) size_t mismatch_avx2(const T* a, const T* b, size_t n) {
+    constexpr size_t lanes = 32 / sizeof(T);
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        unsigned diff;
+        if constexpr (std::same_as<T, float>) {
+            __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_EQ_OQ);
+            diff = ~static_cast<unsigned>(_mm256_movemask_ps(eq)) & 0xFFu;
+        } else if constexpr (std::same_as<T, double>) {
+            __m256d eq = _mm256_cmp_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_EQ_OQ);
+            diff = ~static_cast<unsigned>(_mm256_movemask_pd(eq)) & 0xFu;
+        } else {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            diff = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+        }
+        if (diff) {
+            size_t lane = static_cast<size_t>(__builtin_ctz(diff));
+            return i + (std::integral<T> ? lane / sizeof(T) : lane);
+        }
+    }
+    return i + mismatch_sse2(a + i, b + i, n - i);
+}
+
+inline bool has_avx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#endif
+
+}  // namespace detail
+
+template <Comparable T>
+size_t mismatch(const T* a, const T* b, size_t n) {
+#ifdef MY_CONTAINER_SIMD_X86
+    if (n * sizeof(T) >= 32 && detail::has_avx2()) return detail::mismatch_avx2(a, b, n);
+    return detail::mismatch_sse2(a, b, n);
+#else
+    return detail::mismatch_scalar(a, b, n);
+#endif
+}
+
+template <Comparable T>
+bool equal(const T* a, const T* b, size_t n) {
+    return mismatch(a, b, n) == n;
+}
+
+template <Comparable T>
+std::compare_three_way_result_t<T> compare_three_way(const T* a, size_t a_size, const T* b, size_t b_size) {
+    size_t n = std::min(a_size, b_size);
+    size_t i = mismatch(a, b, n);
+    if (i < n) return a[i] <=> b[i];
+    return a_size <=> b_size;
+}
+
+}  // namespace my_container::simd
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include "../include/allocators.hpp"
+
+using namespace my_container;
+
+TEST(ArenaTest, AllocatesAlignedMemory) {
+    Arena arena(128);
+    for (size_t alignment : {1, 2, 8, 16, 64}) {
+        void* ptr = arena.allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+    }
+}
+
+TEST(ArenaTest, GrowsAndResets) {
+    Arena arena(64);
+    for (int i = 0; i < 100; ++i) arena.allocate(48);
+    size_t reserved = arena.bytes_reserved();
+    EXPECT_GE(reserved, 4800u);
+
+    arena.reset();
+    EXPECT_LE(arena.bytes_reserved(), reserved);
+    EXPECT_GT(arena.bytes_reserved(), 0u);
+
+    void* big = arena.allocate(1 << 16);
+    EXPECT_NE(big, nullptr);
+
+    arena.release();
+    EXPECT_EQ(arena.bytes_reserved(), 0u);
+}
+
+TEST(PoolTest, ReusesFreedBlocks) {
+    Pool pool;
+    void* a = pool.allocate(24);
+    void* b = pool.allocate(24);
+    EXPECT_NE(a, b);
+
+    pool.deallocate(a, 24);
+    EXPECT_EQ(pool.allocate(20), a);
+
+    void* large = pool.allocate(4096);
+    pool.deallocate(large, 4096);
+    pool.deallocate(b, 24);
+}
+
+TEST(AllocatorTest, WorksWithStdContainers) {
+    Arena arena;
+    std::vector<int, ArenaAllocator<int>> v{ArenaAllocator<int>(arena)};
+    for (int i = 0; i < 1000; ++i) v.push_back(i);
+    EXPECT_EQ(v[999], 999);
+
+    Pool pool;
+    PoolAllocator<int> pa(pool);
+    PoolAllocator<double> pd(pa);
+    EXPECT_TRUE(pa == pd);
+    EXPECT_EQ(&pd.resource(), &pool);
+    std::vector<int, PoolAllocator<int>> w{pa};
+    w.assign(100, 7);
+    EXPECT_EQ(w.back(), 7);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "../include/array.hpp"
+#include "../include/simd-compare.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename T>
+void check_every_position(size_t n) {
+    std::vector<T> a(n), b(n);
+    for (size_t i = 0; i < n; ++i) a[i] = b[i] = static_cast<T>(i % 100);
+    EXPECT_EQ(simd::mismatch(a.data(), b.data(), n), n);
+    EXPECT_EQ(simd::detail::mismatch_scalar(a.data(), b.data(), n), n);
+
+    for (size_t pos = 0; pos < n; ++pos) {
+        b[pos] = static_cast<T>(b[pos] + 1);
+        EXPECT_EQ(simd::mismatch(a.data(), b.data(), n), pos);
+#ifdef MY_CONTAINER_SIMD_X86
+        EXPECT_EQ(simd::detail::mismatch_sse2(a.data(), b.data(), n), pos);
+        if (simd::detail::has_avx2()) {
+            EXPECT_EQ(simd::detail::mismatch_avx2(a.data(), b.data(), n), pos);
+        }
+#endif
+        EXPECT_TRUE(simd::compare_three_way(a.data(), n, b.data(), n) < 0);
+        b[pos] = a[pos];
+    }
+}
+
+}
+
+TEST(SimdCompareTest, MismatchAllTypes) {
+    for (size_t n : {0, 1, 7, 16, 33, 100}) {
+        check_every_position<std::int8_t>(n);
+        check_every_position<std::uint16_t>(n);
+        check_every_position<int>(n);
+        check_every_position<std::int64_t>(n);
+        check_every_position<float>(n);
+        check_every_position<double>(n);
+    }
+}
+
+TEST(SimdCompareTest, FloatingPointSemantics) {
+    std::vector<double> a(40, 1.0), b(40, 1.0);
+    a[5] = 0.0;
+    b[5] = -0.0;
+    EXPECT_TRUE(simd::equal(a.data(), b.data(), a.size()));
+
+    a[20] = b[20] = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_EQ(simd::mismatch(a.data(), b.data(), a.size()), 20u);
+    EXPECT_EQ(simd::compare_three_way(a.data(), a.size(), b.data(), b.size()), std::partial_ordering::unordered);
+
+    std::vector<float> f(3, 2.0f);
+    EXPECT_EQ(simd::compare_three_way(f.data(), 2, f.data(), 3), std::partial_ordering::less);
+}
+
+TEST(SimdCompareTest, ArrayOperators) {
+    Array<int, 40> a(7);
+    Array<int, 40> b(7);
+    EXPECT_TRUE(a == b);
+    b[39] = 8;
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE((a <=> b) < 0);
+
+    Array<double, 9> x(0.5);
+    Array<double, 9> y(0.5);
+    EXPECT_TRUE((x <=> y) == 0);
+    y[0] = 0.25;
+    EXPECT_TRUE((x <=> y) > 0);
+}
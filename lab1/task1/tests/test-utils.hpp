@@ -0,0 +1,13 @@
+#pragma once
+#include <vector>
+
+// Общие помощники для тестов контейнеров lab1
+namespace test_utils {
+
+// Содержимое контейнера в порядке обхода — удобно сравнивать с литералом std::vector
+template <typename C>
+std::vector<typename C::value_type> to_vector(const C& container) {
+    return std::vector<typename C::value_type>(container.begin(), container.end());
+}
+
+}  // namespace test_utils
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include "../include/double-linked-list.hpp"
+#include "../../task1/include/allocators.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename Build>
+double measure(size_t rounds, Build build) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) build();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+template <typename T, typename Make>
+void run(const char* name, size_t count, size_t rounds, Make make) {
+    double heap = measure(rounds, [&] {
+        List<T> list;
+        for (size_t i = 0; i < count; ++i) list.push_back(make(i));
+    });
+
+    Arena arena;
+    double arena_time = measure(rounds, [&] {
+        {
+            List<T, 0, ArenaAllocator<T>> list{ArenaAllocator<T>(arena)};
+            for (size_t i = 0; i < count; ++i) list.push_back(make(i));
+        }
+        arena.reset();
+    });
+
+    Pool pool;
+    double pool_time = measure(rounds, [&] {
+        List<T, 0, PoolAllocator<T>> list{PoolAllocator<T>(pool)};
+        for (size_t i = 0; i < count; ++i) list.push_back(make(i));
+    });
+
+    std::printf("%-14s %10zu %12.3f %12.3f %12.3f\n", name, count, heap, arena_time, pool_time);
+}
+
+}
+
+int main() {
+    std::printf("build-then-discard List, ms per round\n");
+    std::printf("%-14s %10s %12s %12s %12s\n", "element", "count", "new/delete", "arena", "pool");
+    for (size_t count : {1000, 100000}) {
+        size_t rounds = 2000000 / count;
+        run<int>("int", count, rounds, [](size_t i) { return static_cast<int>(i); });
+        run<std::string>("std::string", count, rounds, [](size_t i) { return std::to_string(i); });
+    }
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <string>
+#include "../include/double-linked-list.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename F>
+double measure(size_t rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+// Снимок той же длины раз за разом копируется в живой список
+template <typename L, typename Make>
+double refresh(size_t count, size_t rounds, Make make, bool rebuild) {
+    L snapshot;
+    L live;
+    for (size_t i = 0; i < count; ++i) {
+        snapshot.push_back(make(i));
+        live.push_back(make(i + 1));
+    }
+    return measure(rounds, [&] {
+        if (rebuild) {
+            live.clear();
+            for (const auto& value : snapshot) live.push_back(value);
+        } else {
+            live = snapshot;
+        }
+    });
+}
+
+template <typename T, typename Make>
+void run(const char* name, Make make) {
+    for (size_t count : {1'000, 100'000}) {
+        size_t rounds = 20'000'000 / count;
+        std::printf("%-12s %8zu %16.3f %16.3f %16.3f\n", name, count, refresh<List<T>>(count, rounds, make, true),
+                    refresh<List<T>>(count, rounds, make, false), refresh<std::list<T>>(count, rounds, make, false));
+    }
+}
+
+}
+
+int main() {
+    std::printf("ms per refresh of a list from a snapshot of the same length\n");
+    std::printf("%-12s %8s %16s %16s %16s\n", "element", "size", "clear+push_back", "List operator=", "std::list op=");
+    run<int>("int", [](size_t i) { return static_cast<int>(i); });
+    run<std::string>("std::string", [](size_t i) { return std::string(20, static_cast<char>('a' + i % 26)); });
+    return 0;
+}
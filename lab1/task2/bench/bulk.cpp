@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../include/double-linked-list.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename F>
+double measure(size_t rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+// Список, из которого в случайном порядке удалена половина узлов: свободные узлы пула перемешаны
+List<long> churned(size_t count) {
+    List<long> list;
+    std::vector<List<long>::iterator> nodes;
+    for (size_t i = 0; i < count; ++i) {
+        list.push_back(static_cast<long>(i));
+        nodes.push_back(std::prev(list.end()));
+    }
+    std::shuffle(nodes.begin(), nodes.end(), std::mt19937(3));
+    for (size_t i = 0; i < count / 2; ++i) list.erase(nodes[i]);
+    return list;
+}
+
+void row(size_t count) {
+    std::vector<long> source(count / 2);
+    std::iota(source.begin(), source.end(), 0);
+    volatile long sink = 0;
+
+    auto scan_tail = [&](List<long>& list) {
+        auto first = std::prev(list.end(), static_cast<std::ptrdiff_t>(source.size()));
+        return measure(20, [&] { sink = sink + std::accumulate(first, list.end(), 0L); });
+    };
+
+    List<long> by_push = churned(count);
+    double append_push = measure(1, [&] {
+        for (long value : source) by_push.push_back(value);
+    });
+    double scan_push = scan_tail(by_push);
+
+    List<long> by_bulk = churned(count);
+    double append_bulk = measure(1, [&] { by_bulk.bulk_push_back(source.begin(), source.end()); });
+    double scan_bulk = scan_tail(by_bulk);
+
+    double build_push = measure(5, [&] {
+        List<long> list;
+        for (long value : source) list.push_back(value);
+        sink = sink + static_cast<long>(list.size());
+    });
+    double build_range = measure(5, [&] {
+        List<long> list(source.begin(), source.end());
+        sink = sink + static_cast<long>(list.size());
+    });
+
+    std::printf("%9zu %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f\n", count / 2, append_push, append_bulk, scan_push,
+                scan_bulk, build_push, build_range);
+}
+
+}
+
+int main() {
+    std::printf("ms; append/scan: n elements appended to a list whose pool holds n freed nodes in random order\n");
+    std::printf("%9s %12s %12s %12s %12s %12s %12s\n", "n", "push_back", "bulk", "scan push", "scan bulk",
+                "new: push", "new: range");
+    for (size_t count : {20'000, 200'000, 2'000'000}) row(count);
+    return 0;
+}
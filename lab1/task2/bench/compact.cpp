@@ -0,0 +1,88 @@
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <string>
+#include "../include/compact-list.hpp"
+#include "../include/double-linked-list.hpp"
+#include "../include/unrolled-list.hpp"
+
+using namespace my_container;
+
+namespace {
+
+// Считает байты, которые контейнер держит у аллокатора
+inline size_t metered_bytes = 0;
+
+template <typename T>
+struct MeteredAllocator {
+    using value_type = T;
+
+    MeteredAllocator() = default;
+    template <typename U>
+    MeteredAllocator(const MeteredAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        metered_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        metered_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template <typename U>
+    bool operator==(const MeteredAllocator<U>&) const { return true; }
+};
+
+template <typename F>
+double measure(size_t rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+template <typename L, typename Make>
+void row(const char* name, size_t count, Make make) {
+    size_t before = metered_bytes;
+    L list;
+    double build = measure(1, [&] {
+        for (size_t i = 0; i < count; ++i) list.push_back(make(i));
+    });
+    double bytes = static_cast<double>(metered_bytes - before) / static_cast<double>(count);
+    volatile size_t sink = 0;
+    double scan = measure(10, [&] {
+        size_t sum = 0;
+        for (const auto& value : list) sum += sizeof(value);
+        sink = sink + sum;
+    });
+    double copy = measure(5, [&] {
+        L snapshot(list);
+        sink = sink + snapshot.size();
+    });
+    std::printf("%-28s %9zu %12.1f %10.2f %10.2f %10.2f\n", name, count, bytes, build, scan, copy);
+}
+
+template <typename T, typename Make>
+void run(const char* element, Make make) {
+    for (size_t count : {1'000, 1'000'000}) {
+        std::string list_name = std::string("List<") + element + ">";
+        std::string unrolled_name = std::string("UnrolledList<") + element + ">";
+        std::string compact_name = std::string("CompactList<") + element + ">";
+        row<List<T, 0, MeteredAllocator<T>>>(list_name.c_str(), count, make);
+        row<UnrolledList<T, 0, MeteredAllocator<T>>>(unrolled_name.c_str(), count, make);
+        row<CompactList<T, 0, MeteredAllocator<T>>>(compact_name.c_str(), count, make);
+    }
+}
+
+}
+
+int main() {
+    std::printf("bytes/elem: memory held by the container (not the elements' own heap data) after push_back\n");
+    std::printf("%-28s %9s %12s %10s %10s %10s\n", "container", "size", "bytes/elem", "build ms", "scan ms", "copy ms");
+    run<int>("int", [](size_t i) { return static_cast<int>(i); });
+    run<long>("long", [](size_t i) { return static_cast<long>(i); });
+    run<std::string>("std::string", [](size_t i) { return std::string(20, static_cast<char>('a' + i % 26)); });
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "../include/double-linked-list.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename F>
+double measure(size_t rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+// Так индексировался List-Deque до курсора: всегда от головы
+size_t from_head(const List<int>& list, size_t pos) {
+    return static_cast<size_t>(*std::next(list.begin(), static_cast<std::ptrdiff_t>(pos)));
+}
+
+void run(size_t count) {
+    size_t rounds = std::max<size_t>(1, 1'000'000 / count);
+    volatile size_t sink = 0;
+    List<int> list;
+    for (size_t i = 0; i < count; ++i) list.push_back(static_cast<int>(i));
+
+    double forward_head = measure(rounds, [&] {
+        size_t sum = 0;
+        for (size_t i = 0; i < count; ++i) sum += from_head(list, i);
+        sink = sink + sum;
+    });
+    double forward = measure(rounds, [&] {
+        size_t sum = 0;
+        for (size_t i = 0; i < count; ++i) sum += static_cast<size_t>(list[i]);
+        sink = sink + sum;
+    });
+    double backward = measure(rounds, [&] {
+        size_t sum = 0;
+        for (size_t i = count; i-- > 0;) sum += static_cast<size_t>(list[i]);
+        sink = sink + sum;
+    });
+
+    // Случайные номера: курсор не помогает, остаётся выбор ближайшего конца
+    std::mt19937 gen(1);
+    std::vector<size_t> random(std::min<size_t>(count, 1000));
+    for (size_t& pos : random) pos = gen() % count;
+    double random_head = measure(rounds, [&] {
+        size_t sum = 0;
+        for (size_t pos : random) sum += from_head(list, pos);
+        sink = sink + sum;
+    });
+    double random_nearest = measure(rounds, [&] {
+        size_t sum = 0;
+        for (size_t pos : random) sum += static_cast<size_t>(list[pos]);
+        sink = sink + sum;
+    });
+
+    std::printf("%8zu %14.3f %12.3f %12.3f %14.3f %14.3f\n", count, forward_head, forward, backward, random_head,
+                random_nearest);
+}
+
+}  // namespace
+
+int main() {
+    std::printf("ms per loop over List<int>; random: min(size, 1000) lookups\n");
+    std::printf("%8s %14s %12s %12s %14s %14s\n", "size", "seq from head", "seq cursor", "reverse", "random head",
+                "random nearest");
+    for (size_t count : {100, 1'000, 10'000, 30'000}) run(count);
+    return 0;
+}
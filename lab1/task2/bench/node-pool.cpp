@@ -0,0 +1,67 @@
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <string>
+#include "../include/double-linked-list.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename F>
+double measure(size_t rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+// Значения вставляются копией: так у List и std::list одинаковая работа помимо узлов.
+// Очередь постоянной длины: каждый шаг — одно выделение и одно освобождение узла
+template <typename L, typename Make>
+double churn(size_t live, size_t steps, Make make) {
+    L list;
+    for (size_t i = 0; i < live; ++i) list.push_back(make(i));
+    return measure(1, [&] {
+        for (size_t i = 0; i < steps; ++i) {
+            list.pop_front();
+            const auto value = make(i);
+            list.push_back(value);
+        }
+    });
+}
+
+template <typename L, typename Make>
+double build_clear(size_t count, size_t rounds, Make make) {
+    L list;
+    return measure(rounds, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            const auto value = make(i);
+            list.push_back(value);
+        }
+        list.clear();
+    });
+}
+
+template <typename T, typename Make>
+void run(const char* name, Make make) {
+    const size_t steps = 2'000'000;
+    for (size_t live : {1'000, 100'000}) {
+        std::printf("%-12s %-22s %8zu %12.2f %12.2f\n", name, "churn", live, churn<List<T>>(live, steps, make),
+                    churn<std::list<T>>(live, steps, make));
+    }
+    for (size_t count : {1'000, 100'000}) {
+        size_t rounds = 4'000'000 / count;
+        std::printf("%-12s %-22s %8zu %12.3f %12.3f\n", name, "push_back + clear", count,
+                    build_clear<List<T>>(count, rounds, make), build_clear<std::list<T>>(count, rounds, make));
+    }
+}
+
+}
+
+int main() {
+    std::printf("ms per run (churn: %d steps; push_back + clear: per round)\n", 2'000'000);
+    std::printf("%-12s %-22s %8s %12s %12s\n", "element", "workload", "size", "List", "std::list");
+    run<int>("int", [](size_t i) { return static_cast<int>(i); });
+    run<std::string>("std::string", [](size_t i) { return std::string(20, static_cast<char>('a' + i % 26)); });
+    return 0;
+}
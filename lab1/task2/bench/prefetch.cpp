@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../include/double-linked-list.hpp"
+#include "../include/prefetch.hpp"
+
+using namespace my_container;
+
+namespace {
+
+using SkipList = List<int, 0, std::allocator<int>, true>;
+
+template <typename F>
+double measure(size_t rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+// Узлы выделяются по порядку, а sort перевязывает их по значению: порядок обхода становится случайным
+// относительно адресов, и почти каждый переход — промах кэша
+template <typename L>
+void fill_shuffled(L& list, size_t count) {
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(3));
+    list.assign(values.begin(), values.end());
+    list.sort();
+}
+
+// Немного работы на элемент, чтобы было с чем перекрывать промахи
+inline size_t work(int value) {
+    size_t x = static_cast<size_t>(value);
+    x ^= x >> 7;
+    x *= 0x9E3779B97F4A7C15ull;
+    return x ^ (x >> 29);
+}
+
+void run(size_t count) {
+    size_t rounds = std::max<size_t>(1, 4'000'000 / count);
+    volatile size_t sink = 0;
+
+    List<int> sequential;
+    for (size_t i = 0; i < count; ++i) sequential.push_back(static_cast<int>(i));
+    double ordered = measure(rounds, [&] {
+        size_t sum = 0;
+        for (int value : sequential) sum += work(value);
+        sink = sink + sum;
+    });
+
+    List<int> list;
+    fill_shuffled(list, count);
+    double plain = measure(rounds, [&] {
+        size_t sum = 0;
+        for (int value : list) sum += work(value);
+        sink = sink + sum;
+    });
+    std::printf("%9zu %-22s %9.3f\n", count, "sequential nodes", ordered);
+    std::printf("%9zu %-22s %9.3f\n", count, "shuffled, plain", plain);
+
+    for (size_t distance : {2, 4, 8, 16, 32}) {
+        double lookahead = measure(rounds, [&] {
+            size_t sum = 0;
+            for_each_prefetch(list, [&](int value) { sum += work(value); }, distance);
+            sink = sink + sum;
+        });
+        std::printf("%9zu lookahead %-12zu %9.3f\n", count, distance, lookahead);
+    }
+
+    SkipList skip;
+    fill_shuffled(skip, count);
+    double skip_plain = measure(rounds, [&] {
+        size_t sum = 0;
+        for (int value : skip) sum += work(value);
+        sink = sink + sum;
+    });
+    std::printf("%9zu %-22s %9.3f\n", count, "shuffled, skip node", skip_plain);
+    for (size_t distance : {2, 4, 8, 16, 32}) {
+        skip.build_skip_links(distance);
+        double skipped = measure(rounds, [&] {
+            size_t sum = 0;
+            skip.for_each_prefetch([&](int value) { sum += work(value); });
+            sink = sink + sum;
+        });
+        std::printf("%9zu skip links %-11zu %9.3f\n", count, distance, skipped);
+    }
+}
+
+}  // namespace
+
+int main() {
+    std::printf("ms per full traversal of List<int>; shuffled: list order is random relative to node addresses\n");
+    std::printf("%9s %-22s %9s\n", "size", "traversal", "ms");
+    for (size_t count : {10'000, 100'000, 1'000'000, 4'000'000}) run(count);
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <string>
+#include "../include/double-linked-list.hpp"
+#include "../../task5/include/vector.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename F>
+double measure(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename L, typename Make>
+L build(size_t count, Make make) {
+    L list;
+    unsigned seed = 42;
+    for (size_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245 + 12345;
+        list.push_back(make(seed >> 8));
+    }
+    return list;
+}
+
+template <typename T, typename Make>
+void run(const char* name, size_t count, Make make) {
+    auto a = build<List<T>>(count, make);
+    double relink = measure([&] { a.sort(); });
+
+    auto b = build<List<T>>(count, make);
+    double round_trip = measure([&] {
+        Vector<T> buffer;
+        buffer.reserve(b.size());
+        for (const auto& item : b) buffer.push_back(item);
+        std::stable_sort(buffer.begin(), buffer.end());
+        b.clear();
+        for (size_t i = 0; i < buffer.size(); ++i) b.push_back(buffer[i]);
+    });
+
+    auto c = build<std::list<T>>(count, make);
+    double std_sort = measure([&] { c.sort(); });
+
+    List<T> target;
+    auto d = build<List<T>>(count, make);
+    double splice = measure([&] { target.splice(target.end(), d, d.begin(), d.end()); });
+
+    std::printf("%-12s %9zu %12.2f %14.2f %12.2f %12.2f\n", name, count, relink, round_trip, std_sort, splice);
+}
+
+}
+
+int main() {
+    std::printf("ms\n%-12s %9s %12s %14s %12s %12s\n", "element", "count", "List::sort", "via Vector", "std::list", "splice all");
+    for (size_t count : {10'000, 1'000'000}) {
+        run<int>("int", count, [](unsigned x) { return static_cast<int>(x); });
+        run<std::string>("std::string", count, [](unsigned x) { return std::string(24, 'x') + std::to_string(x); });
+    }
+    return 0;
+}
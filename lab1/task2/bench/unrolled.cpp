@@ -0,0 +1,97 @@
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include "../include/double-linked-list.hpp"
+#include "../include/unrolled-list.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename F>
+double measure(size_t rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+std::vector<size_t> positions(size_t count) {
+    std::mt19937 gen(7);
+    std::vector<size_t> result(count);
+    for (size_t i = 0; i < count; ++i) result[i] = gen() % (i + 1);
+    return result;
+}
+
+// Вставка в случайные места: проход до позиции плюс сама вставка; заодно разбрасывает узлы List по памяти
+template <typename L, typename Make>
+void fill_random(L& list, const std::vector<size_t>& where, Make make) {
+    for (size_t i = 0; i < where.size(); ++i) {
+        auto pos = where[i] <= list.size() / 2 ? std::next(list.begin(), where[i])
+                                                : std::prev(list.end(), list.size() - where[i]);
+        list.insert(pos, make(i));
+    }
+}
+
+template <typename L>
+size_t checksum(const L& list) {
+    size_t sum = 0;
+    for (const auto& value : list) {
+        if constexpr (std::is_integral_v<typename L::value_type>) {
+            sum += static_cast<size_t>(value);
+        } else {
+            sum += value.size();
+        }
+    }
+    return sum;
+}
+
+template <typename L, typename Make>
+void row(const char* name, size_t count, Make make) {
+    size_t rounds = std::max<size_t>(1, 2'000'000 / count);
+    volatile size_t sink = 0;
+
+    double build = measure(rounds, [&] {
+        L list;
+        for (size_t i = 0; i < count; ++i) list.push_back(make(i));
+        sink = sink + list.size();
+    });
+
+    L sequential;
+    for (size_t i = 0; i < count; ++i) sequential.push_back(make(i));
+    double scan = measure(rounds * 4, [&] { sink = sink + checksum(sequential); });
+
+    size_t insert_count = std::min<size_t>(count, 20'000);
+    auto where = positions(insert_count);
+    L shuffled;
+    double insert = measure(1, [&] { fill_random(shuffled, where, make); });
+    double scan_shuffled = measure(rounds * 4, [&] { sink = sink + checksum(shuffled); });
+
+    std::printf("%-24s %8zu %10.3f %10.3f %12.2f %14.3f\n", name, count, build, scan, insert, scan_shuffled);
+}
+
+template <typename T, typename Make>
+void run(const char* element, Make make) {
+    for (size_t count : {1'000, 100'000, 1'000'000}) {
+        std::string list_name = std::string("List<") + element + ">";
+        std::string unrolled_name = std::string("UnrolledList<") + element + ">";
+        row<List<T>>(list_name.c_str(), count, make);
+        row<UnrolledList<T>>(unrolled_name.c_str(), count, make);
+    }
+}
+
+}  // namespace
+
+int main() {
+    std::printf("ms per run; insert: min(size, 20000) inserts at random positions; "
+                "scan shuffled: the list built by those inserts\n");
+    std::printf("node capacity: int %zu, std::string %zu\n", UnrolledList<int>::node_capacity,
+                UnrolledList<std::string>::node_capacity);
+    std::printf("%-24s %8s %10s %10s %12s %14s\n", "container", "size", "push_back", "scan", "insert",
+                "scan shuffled");
+    run<int>("int", [](size_t i) { return static_cast<int>(i); });
+    run<std::string>("std::string", [](size_t i) { return std::string(20, static_cast<char>('a' + i % 26)); });
+    return 0;
+}
@@ -0,0 +1,657 @@
+#pragma once
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../../task1/include/container.hpp"
+
+namespace my_container {
+
+namespace detail {
+
+inline constexpr uint32_t compact_npos = std::numeric_limits<uint32_t>::max();
+
+// Связи — 32-битные номера слотов; свободный слот хранит в next следующий свободный
+template <typename T>
+struct CompactSlot {
+    uint32_t next;
+    uint32_t prev;
+    alignas(T) std::byte storage[sizeof(T)];
+
+    T* value() noexcept {
+        return reinterpret_cast<T*>(storage);
+    }
+};
+
+template <typename T>
+struct CompactLinks {
+    CompactSlot<T>* slots = nullptr;
+    uint32_t head = compact_npos;
+    uint32_t tail = compact_npos;
+};
+
+}  // namespace detail
+
+template <typename T, size_t N, typename Alloc>
+class CompactList;
+
+// Итератор — номер слота и указатель на связи списка, поэтому переживает перевыделение массива
+// (ссылки и указатели на элементы при этом становятся недействительными)
+template <typename T, bool Const>
+class CompactListIterator {
+private:
+    using Links = detail::CompactLinks<T>;
+
+    const Links* links_ = nullptr;
+    uint32_t index_ = detail::compact_npos;
+
+    template <typename, size_t, typename>
+    friend class CompactList;
+    friend class CompactListIterator<T, !Const>;
+
+    CompactListIterator(const Links* links, uint32_t index) noexcept : links_(links), index_(index) {}
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    CompactListIterator() = default;
+
+    template <bool OtherConst>
+        requires(Const && !OtherConst)
+    CompactListIterator(const CompactListIterator<T, OtherConst>& other) noexcept
+        : links_(other.links_), index_(other.index_) {}
+
+    reference operator*() const {
+        return *links_->slots[index_].value();
+    }
+
+    pointer operator->() const {
+        return links_->slots[index_].value();
+    }
+
+    CompactListIterator& operator++() {
+        index_ = links_->slots[index_].next;
+        return *this;
+    }
+
+    CompactListIterator operator++(int) {
+        CompactListIterator copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    CompactListIterator& operator--() {
+        index_ = index_ == detail::compact_npos ? links_->tail : links_->slots[index_].prev;
+        return *this;
+    }
+
+    CompactListIterator operator--(int) {
+        CompactListIterator copy = *this;
+        --*this;
+        return copy;
+    }
+
+    template <bool OtherConst>
+    bool operator==(const CompactListIterator<T, OtherConst>& other) const noexcept {
+        return index_ == other.index_;
+    }
+};
+
+// Список с узлами в одном растущем массиве и 32-битными связями вместо указателей.
+// Массив растёт вдвое; освобождённые слоты уходят в цепочку свободных и занимаются первыми.
+// Для тривиально копируемых T копия списка — одно memcpy массива вместе с цепочкой свободных.
+template <typename T, size_t N = 0, typename Alloc = std::allocator<T>>
+class CompactList : public Container<T, N, CompactListIterator<T, false>, CompactListIterator<T, true>> {
+private:
+    using Slot = detail::CompactSlot<T>;
+
+    using SlotAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+    using SlotAllocTraits = std::allocator_traits<SlotAlloc>;
+
+    static constexpr uint32_t npos = detail::compact_npos;
+
+    detail::CompactLinks<T> links;
+    uint32_t free_head = npos;
+    // Слоты [0, carved) уже выдавались хотя бы раз; остальные ни разу не использовались
+    uint32_t carved = 0;
+    uint32_t slot_capacity = 0;
+    size_t current_size = 0;
+    [[no_unique_address]] SlotAlloc slot_alloc;
+
+    Slot& slot(uint32_t index) const noexcept {
+        return links.slots[index];
+    }
+
+    T& value(uint32_t index) const noexcept {
+        return *links.slots[index].value();
+    }
+
+    // Номер npos занят под end(), поэтому слотов не больше npos - 1
+    static constexpr uint32_t max_slots = npos - 1;
+
+    uint32_t grown_capacity() const {
+        if (slot_capacity == max_slots) throw std::length_error("CompactList is full");
+        return static_cast<uint32_t>(std::min<size_t>(max_slots, std::max<size_t>(8, size_t{slot_capacity} * 2)));
+    }
+
+    void destroy_values() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (uint32_t i = links.tail; i != npos; i = slot(i).prev) std::destroy_at(slot(i).value());
+        }
+    }
+
+    void release_buffer() noexcept {
+        if (links.slots) SlotAllocTraits::deallocate(slot_alloc, links.slots, slot_capacity);
+        links.slots = nullptr;
+        slot_capacity = 0;
+    }
+
+    // Переносит связи и живые элементы в fresh с теми же номерами слотов; при исключении fresh не меняется
+    void relocate_into(Slot* fresh) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (carved) std::memcpy(static_cast<void*>(fresh), static_cast<const void*>(links.slots), carved * sizeof(Slot));
+        } else {
+            for (uint32_t i = 0; i < carved; ++i) {
+                fresh[i].next = slot(i).next;
+                fresh[i].prev = slot(i).prev;
+            }
+            uint32_t i = links.head;
+            try {
+                for (; i != npos; i = slot(i).next) {
+                    if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                        std::construct_at(fresh[i].value(), std::move(value(i)));
+                    } else {
+                        std::construct_at(fresh[i].value(), value(i));
+                    }
+                }
+            } catch (...) {
+                for (uint32_t j = links.head; j != i; j = slot(j).next) std::destroy_at(fresh[j].value());
+                throw;
+            }
+        }
+    }
+
+    void adopt(Slot* fresh, uint32_t capacity) noexcept {
+        destroy_values();
+        release_buffer();
+        links.slots = fresh;
+        slot_capacity = capacity;
+    }
+
+    void link_before(uint32_t pos, uint32_t index) noexcept {
+        uint32_t before = pos == npos ? links.tail : slot(pos).prev;
+        slot(index).prev = before;
+        slot(index).next = pos;
+        if (before == npos) {
+            links.head = index;
+        } else {
+            slot(before).next = index;
+        }
+        if (pos == npos) {
+            links.tail = index;
+        } else {
+            slot(pos).prev = index;
+        }
+    }
+
+    void unlink(uint32_t index) noexcept {
+        uint32_t prev = slot(index).prev;
+        uint32_t next = slot(index).next;
+        if (prev == npos) {
+            links.head = next;
+        } else {
+            slot(prev).next = next;
+        }
+        if (next == npos) {
+            links.tail = prev;
+        } else {
+            slot(next).prev = prev;
+        }
+    }
+
+    // Строит элемент из args и вставляет перед pos. При росте массива элемент создаётся в новом буфере
+    // до переноса старых: args могут ссылаться на элемент этого же списка.
+    template <typename... Args>
+    uint32_t emplace_node(uint32_t pos, Args&&... args) {
+        uint32_t index;
+        if (free_head != npos) {
+            index = free_head;
+            std::construct_at(slot(index).value(), std::forward<Args>(args)...);
+            free_head = slot(index).next;
+        } else if (carved < slot_capacity) {
+            index = carved;
+            std::construct_at(slot(index).value(), std::forward<Args>(args)...);
+            ++carved;
+        } else {
+            uint32_t capacity = grown_capacity();
+            Slot* fresh = SlotAllocTraits::allocate(slot_alloc, capacity);
+            index = carved;
+            try {
+                std::construct_at(fresh[index].value(), std::forward<Args>(args)...);
+                try {
+                    relocate_into(fresh);
+                } catch (...) {
+                    std::destroy_at(fresh[index].value());
+                    throw;
+                }
+            } catch (...) {
+                SlotAllocTraits::deallocate(slot_alloc, fresh, capacity);
+                throw;
+            }
+            adopt(fresh, capacity);
+            ++carved;
+        }
+        link_before(pos, index);
+        ++current_size;
+        return index;
+    }
+
+    uint32_t erase_node(uint32_t index) noexcept {
+        uint32_t next = slot(index).next;
+        unlink(index);
+        std::destroy_at(slot(index).value());
+        slot(index).next = free_head;
+        free_head = index;
+        --current_size;
+        return next;
+    }
+
+    template <typename It>
+    void assign_range(It first, It last) {
+        uint32_t curr = links.head;
+        for (; curr != npos && first != last; ++first) {
+            value(curr) = *first;
+            curr = slot(curr).next;
+        }
+        if (curr != npos) {
+            uint32_t keep = slot(curr).prev;
+            while (links.tail != keep) pop_back();
+            return;
+        }
+        for (; first != last; ++first) emplace_back(*first);
+    }
+
+    // Копия с той же раскладкой слотов, включая цепочку свободных
+    void copy_slots(const CompactList& other) {
+        Slot* fresh = SlotAllocTraits::allocate(slot_alloc, other.slot_capacity);
+        std::memcpy(static_cast<void*>(fresh), static_cast<const void*>(other.links.slots), other.carved * sizeof(Slot));
+        links.slots = fresh;
+        slot_capacity = other.slot_capacity;
+        links.head = other.links.head;
+        links.tail = other.links.tail;
+        free_head = other.free_head;
+        carved = other.carved;
+        current_size = other.current_size;
+    }
+
+    void copy_from(const CompactList& other) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (other.slot_capacity) copy_slots(other);
+        } else {
+            reserve(other.current_size);
+            for (const T& item : other) emplace_back(item);
+        }
+    }
+
+    void steal(CompactList& other) noexcept {
+        links = std::exchange(other.links, detail::CompactLinks<T>{});
+        free_head = std::exchange(other.free_head, npos);
+        carved = std::exchange(other.carved, 0);
+        slot_capacity = std::exchange(other.slot_capacity, 0);
+        current_size = std::exchange(other.current_size, 0);
+    }
+
+public:
+    using allocator_type = Alloc;
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using size_type = size_t;
+    using iterator = CompactListIterator<T, false>;
+    using const_iterator = CompactListIterator<T, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using container_type = Container<T, N, iterator, const_iterator>;
+
+    static constexpr size_t slot_size = sizeof(Slot);
+
+    CompactList() = default;
+
+    explicit CompactList(const Alloc& alloc) : slot_alloc(alloc) {}
+
+    CompactList(const CompactList& other)
+        : CompactList(Alloc(SlotAllocTraits::select_on_container_copy_construction(other.slot_alloc))) {
+        copy_from(other);
+    }
+
+    CompactList(CompactList&& other) noexcept : slot_alloc(std::move(other.slot_alloc)) {
+        steal(other);
+    }
+
+    CompactList(std::initializer_list<T> init, const Alloc& alloc = Alloc()) : CompactList(alloc) {
+        reserve(init.size());
+        for (const auto& item : init) emplace_back(item);
+    }
+
+    template <std::input_iterator InputIt>
+    CompactList(InputIt first, InputIt last, const Alloc& alloc = Alloc()) : CompactList(alloc) {
+        if constexpr (std::forward_iterator<InputIt>) reserve(static_cast<size_t>(std::distance(first, last)));
+        for (; first != last; ++first) emplace_back(*first);
+    }
+
+    virtual ~CompactList() {
+        destroy_values();
+        release_buffer();
+    }
+
+    CompactList& operator=(const CompactList& other) {
+        if (this == &other) return *this;
+        if constexpr (SlotAllocTraits::propagate_on_container_copy_assignment::value) {
+            if (slot_alloc != other.slot_alloc) {
+                clear();
+                release_buffer();
+            }
+            slot_alloc = other.slot_alloc;
+        }
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (slot_capacity >= other.carved) {
+                if (other.carved) {
+                    std::memcpy(static_cast<void*>(links.slots), static_cast<const void*>(other.links.slots),
+                                other.carved * sizeof(Slot));
+                }
+                links.head = other.links.head;
+                links.tail = other.links.tail;
+                free_head = other.free_head;
+                carved = other.carved;
+                current_size = other.current_size;
+                return *this;
+            }
+        }
+        assign_range(other.begin(), other.end());
+        return *this;
+    }
+
+    CompactList& operator=(const container_type& other) override {
+        if (this == &other) return *this;
+        const CompactList* other_list = dynamic_cast<const CompactList*>(&other);
+        if (!other_list) {
+            throw std::invalid_argument("Container type mismatch in assignment");
+        }
+        return *this = *other_list;
+    }
+
+    CompactList& operator=(CompactList&& other) noexcept(SlotAllocTraits::propagate_on_container_move_assignment::value ||
+                                                         SlotAllocTraits::is_always_equal::value) {
+        if (this == &other) return *this;
+        if constexpr (!SlotAllocTraits::propagate_on_container_move_assignment::value &&
+                      !SlotAllocTraits::is_always_equal::value) {
+            if (slot_alloc != other.slot_alloc) {
+                clear();
+                for (T& item : other) emplace_back(std::move(item));
+                other.clear();
+                return *this;
+            }
+        }
+        destroy_values();
+        release_buffer();
+        if constexpr (SlotAllocTraits::propagate_on_container_move_assignment::value) {
+            slot_alloc = std::move(other.slot_alloc);
+        }
+        steal(other);
+        return *this;
+    }
+
+    T& front() {
+        if (empty()) throw std::out_of_range("CompactList is empty");
+        return value(links.head);
+    }
+
+    const T& front() const {
+        if (empty()) throw std::out_of_range("CompactList is empty");
+        return value(links.head);
+    }
+
+    T& back() {
+        if (empty()) throw std::out_of_range("CompactList is empty");
+        return value(links.tail);
+    }
+
+    const T& back() const {
+        if (empty()) throw std::out_of_range("CompactList is empty");
+        return value(links.tail);
+    }
+
+    iterator begin() override {
+        return iterator(&links, links.head);
+    }
+
+    const_iterator begin() const override {
+        return const_iterator(&links, links.head);
+    }
+
+    const_iterator cbegin() const override {
+        return begin();
+    }
+
+    iterator end() override {
+        return iterator(&links, npos);
+    }
+
+    const_iterator end() const override {
+        return const_iterator(&links, npos);
+    }
+
+    const_iterator cend() const override {
+        return end();
+    }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    allocator_type get_allocator() const { return Alloc(slot_alloc); }
+
+    bool empty() const override { return current_size == 0; }
+    size_t size() const override { return current_size; }
+    size_t max_size() const override { return current_size; }
+
+    size_t capacity() const noexcept { return slot_capacity; }
+
+    // Заранее выделяет слоты; номера существующих слотов не меняются
+    void reserve(size_t count) {
+        if (count <= slot_capacity) return;
+        if (count > max_slots) throw std::length_error("CompactList::reserve");
+        uint32_t capacity = static_cast<uint32_t>(count);
+        Slot* fresh = SlotAllocTraits::allocate(slot_alloc, capacity);
+        try {
+            relocate_into(fresh);
+        } catch (...) {
+            SlotAllocTraits::deallocate(slot_alloc, fresh, capacity);
+            throw;
+        }
+        adopt(fresh, capacity);
+    }
+
+    // Массив остаётся за списком; слоты нарезаются заново с нулевого
+    void clear() noexcept {
+        destroy_values();
+        links.head = links.tail = free_head = npos;
+        carved = 0;
+        current_size = 0;
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        return value(emplace_node(npos, std::forward<Args>(args)...));
+    }
+
+    void pop_back() {
+        if (!empty()) erase_node(links.tail);
+    }
+
+    void push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_front(Args&&... args) {
+        return value(emplace_node(links.head, std::forward<Args>(args)...));
+    }
+
+    void pop_front() {
+        if (!empty()) erase_node(links.head);
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        return iterator(&links, emplace_node(pos.index_, std::forward<Args>(args)...));
+    }
+
+    iterator erase(const_iterator pos) {
+        if (pos == end()) return end();
+        return iterator(&links, erase_node(pos.index_));
+    }
+
+    template <std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last) {
+        assign_range(first, last);
+    }
+
+    void assign(size_t count, const T& value) {
+        uint32_t curr = links.head;
+        size_t kept = 0;
+        for (; curr != npos && kept < count; ++kept) {
+            this->value(curr) = value;
+            curr = slot(curr).next;
+        }
+        while (current_size > count) pop_back();
+        for (; kept < count; ++kept) emplace_back(value);
+    }
+
+    void resize(size_t count) {
+        while (current_size > count) pop_back();
+        while (current_size < count) emplace_back();
+    }
+
+    void swap(CompactList& other) noexcept {
+        if constexpr (SlotAllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(slot_alloc, other.slot_alloc);
+        }
+        std::swap(links, other.links);
+        std::swap(free_head, other.free_head);
+        std::swap(carved, other.carved);
+        std::swap(slot_capacity, other.slot_capacity);
+        std::swap(current_size, other.current_size);
+    }
+
+    // Устойчивая сортировка перевязыванием: значения не перемещаются
+    template <typename Compare = std::less<>>
+    void sort(Compare comp = {}) {
+        if (current_size < 2) return;
+        std::vector<uint32_t> order;
+        order.reserve(current_size);
+        for (uint32_t i = links.head; i != npos; i = slot(i).next) order.push_back(i);
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return comp(value(a), value(b)); });
+        uint32_t prev = npos;
+        for (uint32_t index : order) {
+            slot(index).prev = prev;
+            if (prev != npos) slot(prev).next = index;
+            prev = index;
+        }
+        slot(prev).next = npos;
+        links.head = order.front();
+        links.tail = prev;
+    }
+
+    template <typename BinaryPredicate = std::equal_to<>>
+    size_t unique(BinaryPredicate equal = {}) {
+        size_t removed = 0;
+        if (empty()) return removed;
+        uint32_t kept = links.head;
+        for (uint32_t i = slot(kept).next; i != npos;) {
+            if (equal(value(kept), value(i))) {
+                i = erase_node(i);
+                ++removed;
+            } else {
+                kept = i;
+                i = slot(i).next;
+            }
+        }
+        return removed;
+    }
+
+    void reverse() noexcept {
+        for (uint32_t i = links.head; i != npos; i = slot(i).prev) std::swap(slot(i).next, slot(i).prev);
+        std::swap(links.head, links.tail);
+    }
+
+    bool operator==(const container_type& other) const override {
+        const CompactList& other_list = static_cast<const CompactList&>(other);
+        return size() == other_list.size() && std::equal(begin(), end(), other_list.begin());
+    }
+
+    bool operator!=(const container_type& other) const override {
+        return !(*this == other);
+    }
+
+    bool operator<(const CompactList& other) const {
+        return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+    }
+
+    bool operator<=(const CompactList& other) const {
+        return !(other < *this);
+    }
+
+    bool operator>(const CompactList& other) const {
+        return other < *this;
+    }
+
+    bool operator>=(const CompactList& other) const {
+        return !(*this < other);
+    }
+
+    auto operator<=>(const CompactList& other) const {
+        return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
+    }
+};
+
+}  // namespace my_container
@@ -1,82 +1,453 @@
 #pragma once
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
 #include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include "../../task1/include/container.hpp"
+#include "node-pool.hpp"
+#include "prefetch.hpp"
 
 namespace my_container {
 
-template <typename T, size_t N = 0>
-class List : public Container<T, N> {
+namespace detail {
+
+template <typename T>
+struct ListNode {
+    T data;
+    ListNode* next;
+    ListNode* prev;
+    // Значение строится прямо в узле из args
+    template <typename... Args>
+    explicit ListNode(ListNode* n, ListNode* p, Args&&... args)
+        : data(std::forward<Args>(args)...), next(n), prev(p) {}
+};
+
+// Узел List<T, N, Alloc, true>: skip указывает на узел на skip_distance позиций дальше.
+// Через skip никогда не читают — это только адрес для предвыборки, поэтому он может и устареть.
+template <typename T>
+struct ListSkipNode : ListNode<T> {
+    ListNode<T>* skip = nullptr;
+    using ListNode<T>::ListNode;
+};
+
+struct NoSkipDistance {};
+
+
+}  // namespace detail
+
+template <typename T, size_t N, typename Alloc, bool SkipLinks>
+class List;
+
+// end() хранит nullptr вместо узла и указатель на хвост списка, чтобы --end() вёл на последний элемент.
+// Поэтому end() становится недействительным после перемещения или swap самого списка.
+template <typename T, bool Const>
+class ListIterator {
+private:
+    using Node = detail::ListNode<T>;
+
+    Node* node_ = nullptr;
+    Node* const* tail_ = nullptr;
+
+    template <typename, size_t, typename, bool>
+    friend class List;
+    friend class ListIterator<T, !Const>;
+
+    ListIterator(Node* node, Node* const* tail) noexcept : node_(node), tail_(tail) {}
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    ListIterator() = default;
+
+    template <bool OtherConst>
+        requires(Const && !OtherConst)
+    ListIterator(const ListIterator<T, OtherConst>& other) noexcept : node_(other.node_), tail_(other.tail_) {}
+
+    reference operator*() const {
+        return node_->data;
+    }
+
+    pointer operator->() const {
+        return &node_->data;
+    }
+
+    ListIterator& operator++() {
+        node_ = node_->next;
+        return *this;
+    }
+
+    ListIterator operator++(int) {
+        ListIterator copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    ListIterator& operator--() {
+        node_ = node_ ? node_->prev : *tail_;
+        return *this;
+    }
+
+    ListIterator operator--(int) {
+        ListIterator copy = *this;
+        --*this;
+        return copy;
+    }
+
+    template <bool OtherConst>
+    bool operator==(const ListIterator<T, OtherConst>& other) const noexcept {
+        return node_ == other.node_;
+    }
+};
+
+// SkipLinks добавляет в каждый узел указатель для предвыборки на несколько узлов вперёд (см. build_skip_links)
+template <typename T, size_t N = 0, typename Alloc = std::allocator<T>, bool SkipLinks = false>
+class List : public Container<T, N, ListIterator<T, false>, ListIterator<T, true>> {
 private:
-    struct Node {
-        T data;
-        Node* next;
-        Node* prev;
-        Node(const T& val = T(), Node* n = nullptr, Node* p = nullptr)
-            : data(val), next(n), prev(p) {}
-    };
+    using Node = detail::ListNode<T>;
+    // Так узел лежит в памяти; снаружи и в связях он виден как Node
+    using StoredNode = std::conditional_t<SkipLinks, detail::ListSkipNode<T>, Node>;
+
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<StoredNode>;
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
+    using NodePool = detail::NodePool<StoredNode, NodeAlloc>;
 
     Node* head;
     Node* tail;
     size_t current_size;
+    [[no_unique_address]] NodeAlloc node_alloc;
+    // Создаётся при первой вставке, память берёт из node_alloc слэбами
+    NodePool* node_pool = nullptr;
+    // После splice/merge из другого списка часть узлов может принадлежать чужому пулу
+    bool foreign_nodes = false;
+    // 0 — ссылки skip не поддерживаются
+    [[no_unique_address]] std::conditional_t<SkipLinks, size_t, detail::NoSkipDistance> skip_distance{};
+    // Узел и номер последнего неконстантного обращения по номеру; nullptr — курсора нет
+    Node* cursor_node = nullptr;
+    size_t cursor_index = 0;
+
+    template <typename... Args>
+    Node* create_node(Args&&... args) {
+        if (!node_pool) node_pool = NodePool::create(node_alloc);
+        StoredNode* node = node_pool->allocate();
+        try {
+            std::construct_at(node, std::forward<Args>(args)...);
+        } catch (...) {
+            NodePool::deallocate(node);
+            throw;
+        }
+        return node;
+    }
+
+    void destroy_node(Node* node) {
+        StoredNode* stored = static_cast<StoredNode*>(node);
+        std::destroy_at(stored);
+        NodePool::deallocate(stored);
+    }
+
+    void release_pool() noexcept {
+        if (node_pool) node_pool->release();
+        node_pool = nullptr;
+    }
+
+    // Строит узел из args и вставляет его перед pos; pos == nullptr — в конец
+    template <typename... Args>
+    Node* emplace_node(Node* pos, Args&&... args) {
+        Node* node = create_node(nullptr, nullptr, std::forward<Args>(args)...);
+        if (cursor_node && pos) {
+            if (pos == head || pos == cursor_node) {
+                ++cursor_index;
+            } else if (pos != cursor_node->next) {
+                drop_cursor();
+            }
+        }
+        link_before(pos, node, node);
+        ++current_size;
+        if (!pos) extend_skip_links(node);
+        return node;
+    }
+
+    void drop_cursor() noexcept {
+        cursor_node = nullptr;
+    }
+
+    static Node* walk(Node* node, size_t index, size_t pos) noexcept {
+        for (; index < pos; ++index) node = node->next;
+        for (; index > pos; --index) node = node->prev;
+        return node;
+    }
+
+    // Идёт к pos от ближайшего конца и ничего не запоминает: const-доступ из нескольких потоков безопасен
+    Node* node_at(size_t pos) const noexcept {
+        if (pos <= current_size - 1 - pos) return walk(head, 0, pos);
+        return walk(tail, current_size - 1, pos);
+    }
+
+    // Идёт к pos от ближайшей из трёх точек — головы, хвоста или курсора — и ставит туда курсор
+    Node* node_at(size_t pos) noexcept {
+        Node* node = head;
+        size_t index = 0;
+        size_t best = pos;
+        if (current_size - 1 - pos < best) {
+            node = tail;
+            index = current_size - 1;
+            best = current_size - 1 - pos;
+        }
+        if (cursor_node) {
+            size_t distance = pos > cursor_index ? pos - cursor_index : cursor_index - pos;
+            if (distance < best) {
+                node = cursor_node;
+                index = cursor_index;
+            }
+        }
+        node = walk(node, index, pos);
+        cursor_node = node;
+        cursor_index = pos;
+        return node;
+    }
+
+    // Перенацеливает skip у узлов, которые смотрят на дописанный в конец хвост first..tail:
+    // O(длины хвоста + skip_distance)
+    void extend_skip_links(Node* first) noexcept {
+        if constexpr (SkipLinks) {
+            if (skip_distance == 0) return;
+            Node* from = first;
+            for (size_t i = 0; i < skip_distance && from->prev; ++i) from = from->prev;
+            Node* lead = from;
+            for (size_t i = 0; i < skip_distance && lead; ++i) lead = lead->next;
+            for (Node* curr = from; curr; curr = curr->next) {
+                static_cast<StoredNode*>(curr)->skip = lead;
+                if (lead) lead = lead->next;
+            }
+        }
+    }
+
+    // Вставляет цепочку first..last (связанную через next/prev) перед pos; pos == nullptr — в конец
+    void link_before(Node* pos, Node* first, Node* last) noexcept {
+        Node* before = pos ? pos->prev : tail;
+        first->prev = before;
+        last->next = pos;
+        if (before) {
+            before->next = first;
+        } else {
+            head = first;
+        }
+        if (pos) {
+            pos->prev = last;
+        } else {
+            tail = last;
+        }
+    }
+
+    // Вырезает цепочку first..last, не трогая current_size
+    void unlink(Node* first, Node* last) noexcept {
+        if (first->prev) {
+            first->prev->next = last->next;
+        } else {
+            head = last->next;
+        }
+        if (last->next) {
+            last->next->prev = first->prev;
+        } else {
+            tail = first->prev;
+        }
+        first->prev = nullptr;
+        last->next = nullptr;
+    }
+
+    // Сливает две односвязные (по next) отсортированные цепочки; при равенстве первой идёт a.
+    // Если comp бросит, в out всё равно окажутся все узлы обеих цепочек.
+    template <typename Compare>
+    static void merge_runs(Node*& out, Node* a, Node* b, Compare& comp) {
+        Node* result = nullptr;
+        Node** link = &result;
+        try {
+            while (a && b) {
+                if (comp(b->data, a->data)) {
+                    *link = b;
+                    b = b->next;
+                } else {
+                    *link = a;
+                    a = a->next;
+                }
+                link = &(*link)->next;
+            }
+        } catch (...) {
+            *link = a;
+            while (*link) link = &(*link)->next;
+            *link = b;
+            out = result;
+            throw;
+        }
+        *link = a ? a : b;
+        out = result;
+    }
+
+    static Node* concat(Node* a, Node* b) noexcept {
+        if (!a) return b;
+        Node* last = a;
+        while (last->next) last = last->next;
+        last->next = b;
+        return a;
+    }
+
+    // Восстанавливает prev, head и tail по односвязной цепочке
+    void relink(Node* first) noexcept {
+        head = first;
+        Node* prev = nullptr;
+        for (Node* curr = first; curr; curr = curr->next) {
+            curr->prev = prev;
+            prev = curr;
+        }
+        tail = prev;
+    }
+
+    // Перезаписывает значения в уже существующих узлах; узлы выделяются или освобождаются
+    // только на разницу в длине
+    template <typename It>
+    void assign_range(It first, It last) {
+        Node* curr = head;
+        for (; curr && first != last; ++first) {
+            curr->data = *first;
+            curr = curr->next;
+        }
+        if (curr) {
+            Node* keep = curr->prev;
+            while (tail != keep) pop_back();
+            return;
+        }
+        bulk_push_back(first, last);
+    }
 
 public:
+    using allocator_type = Alloc;
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using size_type = size_t;
+    using iterator = ListIterator<T, false>;
+    using const_iterator = ListIterator<T, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using container_type = Container<T, N, iterator, const_iterator>;
+
     List() : head(nullptr), tail(nullptr), current_size(0) {}
 
-    List(const List& other) : List() {
-        for (Node* curr = other.head; curr != nullptr; curr = curr->next) {
-            push_back(curr->data);
-        }
+    explicit List(const Alloc& alloc) : head(nullptr), tail(nullptr), current_size(0), node_alloc(alloc) {}
+
+    List(const List& other)
+        : List(Alloc(NodeAllocTraits::select_on_container_copy_construction(other.node_alloc))) {
+        skip_distance = other.skip_distance;
+        bulk_push_back(other.begin(), other.end());
+    }
+
+    template <std::input_iterator InputIt>
+    List(InputIt first, InputIt last, const Alloc& alloc = Alloc()) : List(alloc) {
+        bulk_push_back(first, last);
     }
 
-    List(List&& other) noexcept 
-        : head(other.head), tail(other.tail), current_size(other.current_size) {
+    List(List&& other) noexcept
+        : head(other.head),
+          tail(other.tail),
+          current_size(other.current_size),
+          node_alloc(std::move(other.node_alloc)),
+          node_pool(std::exchange(other.node_pool, nullptr)),
+          foreign_nodes(std::exchange(other.foreign_nodes, false)),
+          skip_distance(other.skip_distance),
+          cursor_node(std::exchange(other.cursor_node, nullptr)),
+          cursor_index(other.cursor_index) {
         other.head = nullptr;
         other.tail = nullptr;
         other.current_size = 0;
     }
 
-    List(std::initializer_list<T> init) : List() {
-        for (const auto& item : init) {
-            push_back(item);
-        }
+    List(std::initializer_list<T> init, const Alloc& alloc = Alloc()) : List(alloc) {
+        bulk_push_back(init.begin(), init.end());
     }
 
     virtual ~List() {
         clear();
+        release_pool();
     }
 
+    // Узлы *this переиспользуются; заново строится только разница в длине
     List& operator=(const List& other) {
         if (this != &other) {
-            clear();
-            for (Node* curr = other.head; curr != nullptr; curr = curr->next) {
-                push_back(curr->data);
+            if constexpr (NodeAllocTraits::propagate_on_container_copy_assignment::value) {
+                if (node_alloc != other.node_alloc) {
+                    clear();
+                    release_pool();
+                }
+                node_alloc = other.node_alloc;
             }
+            assign_range(other.begin(), other.end());
         }
         return *this;
     }
-    List& operator=(const Container<T, N>& other) override {
+    List& operator=(const container_type& other) override {
         if (this == &other) return *this;
     
         const List* other_list = dynamic_cast<const List*>(&other);
         if (!other_list) {
             throw std::invalid_argument("Container type mismatch in assignment");
         }
-    
-        clear();
-    
-        for (const Node* curr = other_list->head; curr != nullptr; curr = curr->next) {
-            push_back(curr->data);
-        }
-    
+
+        assign_range(other_list->begin(), other_list->end());
         return *this;
     }
 
-    List& operator=(List&& other) noexcept {
+    template <std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last) {
+        assign_range(first, last);
+    }
+
+    void assign(size_t count, const T& value) {
+        Node* curr = head;
+        size_t kept = 0;
+        for (; curr && kept < count; ++kept) {
+            curr->data = value;
+            curr = curr->next;
+        }
+        while (current_size > count) pop_back();
+        for (; kept < count; ++kept) emplace_back(value);
+    }
+
+    void assign(std::initializer_list<T> init) {
+        assign_range(init.begin(), init.end());
+    }
+
+    List& operator=(List&& other) noexcept(NodeAllocTraits::propagate_on_container_move_assignment::value ||
+                                           NodeAllocTraits::is_always_equal::value) {
         if (this != &other) {
             clear();
+            if constexpr (!NodeAllocTraits::propagate_on_container_move_assignment::value &&
+                          !NodeAllocTraits::is_always_equal::value) {
+                if (node_alloc != other.node_alloc) {
+                    for (Node* curr = other.head; curr != nullptr; curr = curr->next) {
+                        push_back(std::move(curr->data));
+                    }
+                    other.clear();
+                    return *this;
+                }
+            }
+            if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::value) {
+                node_alloc = std::move(other.node_alloc);
+            }
+            release_pool();
+            node_pool = std::exchange(other.node_pool, nullptr);
+            foreign_nodes = std::exchange(other.foreign_nodes, false);
+            skip_distance = other.skip_distance;
+            cursor_node = std::exchange(other.cursor_node, nullptr);
+            cursor_index = other.cursor_index;
             head = other.head;
             tail = other.tail;
             current_size = other.current_size;
@@ -107,130 +478,209 @@ public:
         return tail->data;
     }
 
-    T* begin() override { 
-        return head ? &head->data : nullptr; 
+    // Неконстантный поиск идёт от ближайшей точки: головы, хвоста или места прошлого обращения, так что проход
+    // list[0], list[1], ... стоит O(1) на шаг. const-версии курсор не трогают и идут от ближайшего конца.
+    T& operator[](size_t pos) {
+        return node_at(pos)->data;
+    }
+
+    const T& operator[](size_t pos) const {
+        return node_at(pos)->data;
     }
 
-    const T* begin() const override { 
-        return head ? &head->data : nullptr; 
+    T& at(size_t pos) {
+        if (pos >= current_size) throw std::out_of_range("List index out of range");
+        return node_at(pos)->data;
     }
 
-    const T* cbegin() const override { 
-        return begin(); 
+    const T& at(size_t pos) const {
+        if (pos >= current_size) throw std::out_of_range("List index out of range");
+        return node_at(pos)->data;
     }
 
-    T* end() override { 
-        return nullptr; 
+    iterator begin() override {
+        return iterator(head, &tail);
     }
 
-    const T* end() const override { 
-        return nullptr; 
+    const_iterator begin() const override {
+        return const_iterator(head, &tail);
     }
 
-    const T* cend() const override { 
-        return end(); 
+    const_iterator cbegin() const override {
+        return begin();
     }
-    T* next(T* current) const {
-        if (!current) return nullptr;
-        Node* node = reinterpret_cast<Node*>(reinterpret_cast<char*>(current) - offsetof(Node, data));
-        return node->next ? &node->next->data : nullptr;
+
+    iterator end() override {
+        return iterator(nullptr, &tail);
     }
 
-    T* rbegin()  { return tail ? &tail->data : nullptr; }
-    const T* rbegin() const  { return tail ? &tail->data : nullptr; }
-    const T* crbegin() const  { return tail ? &tail->data : nullptr; }
-    T* rend()  { return nullptr; }
-    const T* rend() const  { return nullptr; }
-    const T* crend() const  { return nullptr; }
-    T* prev(T* current) const {
-        if (!current) return nullptr;
-        Node* node = reinterpret_cast<Node*>(reinterpret_cast<char*>(current) - offsetof(Node, data));
-        return node->prev ? &node->prev->data : nullptr;
+    const_iterator end() const override {
+        return const_iterator(nullptr, &tail);
     }
-    Node* getNodeFromDataPtr(T* dataPtr) const {
-        if (!dataPtr) return nullptr;
-        return reinterpret_cast<Node*>(reinterpret_cast<char*>(dataPtr) - offsetof(Node, data));
+
+    const_iterator cend() const override {
+        return end();
     }
 
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    allocator_type get_allocator() const { return Alloc(node_alloc); }
+
     bool empty() const override { return current_size == 0; }
     size_t size() const override { return current_size; }
     size_t max_size() const override { return current_size; }
 
+    // Если все узлы пула принадлежат этому списку, память возвращается слэбами, а не по узлу
     void clear() {
-        while (!empty()) {
-            pop_front();
+        drop_cursor();
+        if (!node_pool || foreign_nodes || node_pool->live() != current_size) {
+            while (!empty()) {
+                pop_front();
+            }
+            foreign_nodes = false;
+            return;
         }
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (Node* curr = head; curr != nullptr;) {
+                Node* next = curr->next;
+                std::destroy_at(static_cast<StoredNode*>(curr));
+                curr = next;
+            }
+        }
+        node_pool->reset();
+        head = nullptr;
+        tail = nullptr;
+        current_size = 0;
     }
 
     void push_back(const T& value) {
-        Node* newNode = new Node(value, nullptr, tail);
-        if (tail) {
-            tail->next = newNode;
-        } else {
-            head = newNode;
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        return emplace_node(nullptr, std::forward<Args>(args)...)->data;
+    }
+
+    // Узлы нарезаются подряд из свежей части слэбов, а не из освобождённых ранее, так что новый хвост лежит
+    // в памяти последовательно. Если конструктор элемента бросит, список останется прежним.
+    template <std::input_iterator InputIt>
+    void bulk_push_back(InputIt first, InputIt last) {
+        if (first == last) return;
+        if (!node_pool) node_pool = NodePool::create(node_alloc);
+        Node* chain_head = nullptr;
+        Node* chain_tail = nullptr;
+        StoredNode* hint = static_cast<StoredNode*>(tail);
+        size_t count = 0;
+        try {
+            for (; first != last; ++first) {
+                StoredNode* node = node_pool->allocate_after(hint);
+                try {
+                    std::construct_at(node, nullptr, chain_tail, *first);
+                } catch (...) {
+                    NodePool::deallocate(node);
+                    throw;
+                }
+                if (chain_tail) {
+                    chain_tail->next = node;
+                } else {
+                    chain_head = node;
+                }
+                chain_tail = hint = node;
+                ++count;
+            }
+        } catch (...) {
+            while (chain_tail) {
+                Node* prev = chain_tail->prev;
+                destroy_node(chain_tail);
+                chain_tail = prev;
+            }
+            throw;
         }
-        tail = newNode;
-        ++current_size;
+        link_before(nullptr, chain_head, chain_tail);
+        current_size += count;
+        extend_skip_links(chain_head);
     }
 
     void pop_back() {
         if (empty()) return;
         Node* temp = tail;
+        if (cursor_node == temp) drop_cursor();
         tail = tail->prev;
         if (tail) {
             tail->next = nullptr;
         } else {
             head = nullptr;
         }
-        delete temp;
+        destroy_node(temp);
         --current_size;
     }
 
     void push_front(const T& value) {
-        Node* newNode = new Node(value, head, nullptr);
-        if (head) {
-            head->prev = newNode;
-        } else {
-            tail = newNode;
-        }
-        head = newNode;
-        ++current_size;
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_front(Args&&... args) {
+        return emplace_node(head, std::forward<Args>(args)...)->data;
     }
 
     void pop_front() {
         if (empty()) return;
         Node* temp = head;
+        if (cursor_node == temp) {
+            drop_cursor();
+        } else if (cursor_node) {
+            --cursor_index;
+        }
         head = head->next;
         if (head) {
             head->prev = nullptr;
         } else {
             tail = nullptr;
         }
-        delete temp;
+        destroy_node(temp);
         --current_size;
     }
 
-    T* insert(T* pos, const T& value) {
-        if (pos == nullptr) {
-            push_back(value);
-            return &tail->data;
-        }
-        Node* target = getNodeFromDataPtr(pos);
-        Node* newNode = new Node(value, target, target->prev);
-        if (target->prev) {
-            target->prev->next = newNode;
-        } else {
-            head = newNode;
-        }
-        target->prev = newNode;
-        ++current_size;
-        return &newNode->data;
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
     }
 
-    T* erase(T* pos) {
-        if (pos == nullptr) return nullptr;
-        Node* target = getNodeFromDataPtr(pos);
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        return iterator(emplace_node(pos.node_, std::forward<Args>(args)...), &tail);
+    }
+
+    iterator erase(const_iterator pos) {
+        if (pos == end()) return end();
+        Node* target = pos.node_;
         Node* nextNode = target->next;
+        // Курсор на удаляемом узле переходит на следующий с тем же номером
+        if (cursor_node == target) {
+            cursor_node = nextNode;
+        } else if (cursor_node && target == head) {
+            --cursor_index;
+        } else if (target != tail) {
+            drop_cursor();
+        }
         if (target->prev) {
             target->prev->next = nextNode;
         } else {
@@ -240,23 +690,227 @@ public:
             tail = target->prev;
         }
         if (nextNode) nextNode->prev = target->prev;
-        delete target;
+        destroy_node(target);
         --current_size;
-        return nextNode ? &nextNode->data : nullptr;
+        return iterator(nextNode, &tail);
     }
 
     void resize(size_t count) {
         while (current_size > count) pop_back();
-        while (current_size < count) push_back(T());
+        while (current_size < count) emplace_back();
     }
 
     void swap(List& other) noexcept {
+        if constexpr (NodeAllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(node_alloc, other.node_alloc);
+        }
         std::swap(head, other.head);
         std::swap(tail, other.tail);
         std::swap(current_size, other.current_size);
+        std::swap(node_pool, other.node_pool);
+        std::swap(foreign_nodes, other.foreign_nodes);
+        std::swap(skip_distance, other.skip_distance);
+        std::swap(cursor_node, other.cursor_node);
+        std::swap(cursor_index, other.cursor_index);
+    }
+
+    // Ставит каждому узлу skip на узел в distance позициях дальше (distance == 0 — выключает ссылки).
+    // Дальше их поддерживают push_back/emplace_back/bulk_push_back; прочие правки (вставка в середину,
+    // удаление, splice, sort, reverse) оставляют часть ссылок устаревшими — это стоит лишь бесполезной
+    // предвыборки, пока build_skip_links не будет вызван снова.
+    void build_skip_links(size_t distance) noexcept
+        requires SkipLinks
+    {
+        skip_distance = distance;
+        if (head) extend_skip_links(head);
+    }
+
+    size_t skip_links_distance() const noexcept
+        requires SkipLinks
+    {
+        return skip_distance;
+    }
+
+    // Обход с предвыборкой по skip: промахи по узлам на skip_distance вперёд идут параллельно с обработкой
+    // текущего. Без построенных ссылок — обычный обход с ведущим итератором на distance узлов вперёд.
+    template <typename F>
+    void for_each_prefetch(F f, size_t distance = default_prefetch_distance)
+        requires SkipLinks
+    {
+        if (skip_distance == 0) {
+            for (T& value : prefetching(*this, distance)) f(value);
+            return;
+        }
+        for (Node* curr = head; curr; curr = curr->next) {
+            detail::prefetch(static_cast<StoredNode*>(curr)->skip);
+            f(curr->data);
+        }
+    }
+
+    template <typename F>
+    void for_each_prefetch(F f, size_t distance = default_prefetch_distance) const
+        requires SkipLinks
+    {
+        if (skip_distance == 0) {
+            for (const T& value : prefetching(*this, distance)) f(value);
+            return;
+        }
+        for (const Node* curr = head; curr; curr = curr->next) {
+            detail::prefetch(static_cast<const StoredNode*>(curr)->skip);
+            f(curr->data);
+        }
+    }
+
+    // Узлы переносятся без копирования значений; память узла остаётся за пулом, где он был создан,
+    // поэтому аллокаторы списков не обязаны совпадать
+    void splice(const_iterator pos, List& other) {
+        if (&other == this || other.empty()) return;
+        drop_cursor();
+        other.drop_cursor();
+        Node* first = other.head;
+        Node* last = other.tail;
+        size_t count = other.current_size;
+        other.unlink(first, last);
+        other.current_size = 0;
+        link_before(pos.node_, first, last);
+        current_size += count;
+        foreign_nodes = true;
+    }
+
+    void splice(const_iterator pos, List&& other) {
+        splice(pos, other);
+    }
+
+    void splice(const_iterator pos, List& other, const_iterator it) {
+        Node* node = it.node_;
+        if (&other == this && (node == pos.node_ || node->next == pos.node_)) return;
+        drop_cursor();
+        other.drop_cursor();
+        other.unlink(node, node);
+        --other.current_size;
+        link_before(pos.node_, node, node);
+        ++current_size;
+        if (&other != this) foreign_nodes = true;
+    }
+
+    void splice(const_iterator pos, List&& other, const_iterator it) {
+        splice(pos, other, it);
+    }
+
+    // Между разными списками — O(длины диапазона) на пересчёт размера, внутри одного — O(1).
+    // pos не должен лежать внутри [first, last).
+    void splice(const_iterator pos, List& other, const_iterator first, const_iterator last) {
+        if (first == last) return;
+        drop_cursor();
+        other.drop_cursor();
+        Node* first_node = first.node_;
+        Node* last_node = last.node_ ? last.node_->prev : other.tail;
+        if (&other != this) {
+            size_t count = static_cast<size_t>(std::distance(first, last));
+            other.current_size -= count;
+            current_size += count;
+            foreign_nodes = true;
+        } else if (pos.node_ == last.node_) {
+            return;
+        }
+        other.unlink(first_node, last_node);
+        link_before(pos.node_, first_node, last_node);
+    }
+
+    void splice(const_iterator pos, List&& other, const_iterator first, const_iterator last) {
+        splice(pos, other, first, last);
+    }
+
+    // Оба списка должны быть отсортированы по comp; при равенстве элементы *this идут раньше
+    template <typename Compare = std::less<>>
+    void merge(List& other, Compare comp = {}) {
+        if (&other == this || other.empty()) return;
+        foreign_nodes = true;
+        drop_cursor();
+        other.drop_cursor();
+        Node* curr = head;
+        while (other.head) {
+            Node* node = other.head;
+            while (curr && !comp(node->data, curr->data)) curr = curr->next;
+            if (!curr) {
+                splice(end(), other);
+                return;
+            }
+            other.unlink(node, node);
+            --other.current_size;
+            link_before(curr, node, node);
+            ++current_size;
+        }
+    }
+
+    template <typename Compare = std::less<>>
+    void merge(List&& other, Compare comp = {}) {
+        merge(other, comp);
+    }
+
+    // Устойчивая сортировка слиянием снизу вверх: узлы перевязываются, значения не копируются.
+    // bins[i] хранит отсортированный отрезок из 2^i узлов, более старые отрезки — в старших разрядах.
+    template <typename Compare = std::less<>>
+    void sort(Compare comp = {}) {
+        if (current_size < 2) return;
+        drop_cursor();
+        Node* bins[64] = {};
+        Node* rest = head;
+        Node* run = nullptr;
+        try {
+            while (rest) {
+                run = rest;
+                rest = rest->next;
+                run->next = nullptr;
+                size_t i = 0;
+                for (; bins[i]; ++i) {
+                    Node* bin = std::exchange(bins[i], nullptr);
+                    merge_runs(run, bin, run, comp);
+                }
+                bins[i] = std::exchange(run, nullptr);
+            }
+            for (Node*& bin : bins) {
+                if (bin) merge_runs(run, std::exchange(bin, nullptr), run, comp);
+            }
+        } catch (...) {
+            // Порядок после исключения не определён, но все узлы остаются в списке
+            Node* all = concat(run, rest);
+            for (Node* bin : bins) all = concat(bin, all);
+            relink(all);
+            throw;
+        }
+        relink(run);
+    }
+
+    template <typename BinaryPredicate = std::equal_to<>>
+    size_t unique(BinaryPredicate equal = {}) {
+        size_t removed = 0;
+        if (!head) return removed;
+        drop_cursor();
+        Node* kept = head;
+        while (Node* node = kept->next) {
+            if (equal(kept->data, node->data)) {
+                unlink(node, node);
+                destroy_node(node);
+                --current_size;
+                ++removed;
+            } else {
+                kept = node;
+            }
+        }
+        return removed;
+    }
+
+    void reverse() noexcept {
+        drop_cursor();
+        for (Node* curr = head; curr; curr = curr->prev) {
+            std::swap(curr->next, curr->prev);
+        }
+        std::swap(head, tail);
     }
 
-    bool operator==(const Container<T, N>& other) const override {
+    bool operator==(const container_type& other) const override {
         const List& otherList = static_cast<const List&>(other);
         if (size() != otherList.size()) return false;
         const Node* curr1 = head;
@@ -269,7 +923,7 @@ public:
         return true;
     }
 
-    bool operator!=(const Container<T, N>& other) const override {
+    bool operator!=(const container_type& other) const override {
         return !(*this == other);
     }
 
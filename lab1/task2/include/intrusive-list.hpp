@@ -0,0 +1,376 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace my_container {
+
+#ifdef NDEBUG
+inline constexpr bool intrusive_safe_mode = false;
+#else
+inline constexpr bool intrusive_safe_mode = true;
+#endif
+
+// Хук, который объект хранит в себе. Не связанный хук имеет next == nullptr.
+// Копия объекта не наследует места в списке, поэтому копирование хука ничего не переносит.
+struct IntrusiveListHook {
+    IntrusiveListHook* next = nullptr;
+    IntrusiveListHook* prev = nullptr;
+
+    IntrusiveListHook() = default;
+    IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept { return *this; }
+
+    bool is_linked() const noexcept { return next != nullptr; }
+};
+
+namespace detail {
+
+// Смещение хука внутри T. Адрес члена берётся у выровненного буфера размером с T: объект там не создаётся и
+// ничего не читается. Для стандартной раскладки смещение члена одинаково у всех объектов T.
+template <typename T, IntrusiveListHook T::*Hook>
+std::ptrdiff_t hook_offset() noexcept {
+    static_assert(std::is_standard_layout_v<T>, "IntrusiveList requires a standard-layout element type");
+    alignas(T) static const unsigned char storage[sizeof(T)] = {};
+    const T* object = reinterpret_cast<const T*>(storage);
+    return reinterpret_cast<const unsigned char*>(&(object->*Hook)) - storage;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+T* owner_of(IntrusiveListHook* hook) noexcept {
+    return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - hook_offset<T, Hook>());
+}
+
+}  // namespace detail
+
+template <typename T, IntrusiveListHook T::*Hook, bool Safe>
+class IntrusiveList;
+
+// Итератор — указатель на хук; end() — хук-заглушка самого списка, поэтому --end() ведёт на последний элемент
+template <typename T, IntrusiveListHook T::*Hook, bool Const>
+class IntrusiveListIterator {
+private:
+    IntrusiveListHook* hook_ = nullptr;
+
+    template <typename U, IntrusiveListHook U::*, bool>
+    friend class IntrusiveList;
+    friend class IntrusiveListIterator<T, Hook, !Const>;
+
+    explicit IntrusiveListIterator(IntrusiveListHook* hook) noexcept : hook_(hook) {}
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    IntrusiveListIterator() = default;
+
+    template <bool OtherConst>
+        requires(Const && !OtherConst)
+    IntrusiveListIterator(const IntrusiveListIterator<T, Hook, OtherConst>& other) noexcept : hook_(other.hook_) {}
+
+    reference operator*() const {
+        return *detail::owner_of<T, Hook>(hook_);
+    }
+
+    pointer operator->() const {
+        return detail::owner_of<T, Hook>(hook_);
+    }
+
+    IntrusiveListIterator& operator++() {
+        hook_ = hook_->next;
+        return *this;
+    }
+
+    IntrusiveListIterator operator++(int) {
+        IntrusiveListIterator copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    IntrusiveListIterator& operator--() {
+        hook_ = hook_->prev;
+        return *this;
+    }
+
+    IntrusiveListIterator operator--(int) {
+        IntrusiveListIterator copy = *this;
+        --*this;
+        return copy;
+    }
+
+    template <bool OtherConst>
+    bool operator==(const IntrusiveListIterator<T, Hook, OtherConst>& other) const noexcept {
+        return hook_ == other.hook_;
+    }
+};
+
+// Список объектов, которые сами хранят хук: связывание и отвязывание ничего не выделяют.
+// T должен иметь стандартную раскладку: по адресу хука объект находится вычитанием постоянного смещения.
+// Список не владеет объектами — они должны пережить своё пребывание в нём; clear() и деструктор только
+// отвязывают хуки. В безопасном режиме (по умолчанию без NDEBUG) повторная вставка связанного объекта и
+// отвязывание несвязанного бросают std::logic_error.
+template <typename T, IntrusiveListHook T::*Hook, bool Safe = intrusive_safe_mode>
+class IntrusiveList {
+    static_assert(std::is_standard_layout_v<T>, "IntrusiveList requires a standard-layout element type");
+
+private:
+    // Кольцо через заглушку: у связанного хука оба соседа всегда есть
+    IntrusiveListHook root;
+    size_t current_size = 0;
+
+    static IntrusiveListHook* hook_of(T& value) noexcept {
+        return &(value.*Hook);
+    }
+
+    static void check_unlinked(const IntrusiveListHook* hook) {
+        if constexpr (Safe) {
+            if (hook->is_linked()) throw std::logic_error("IntrusiveList: object is already linked");
+        }
+    }
+
+    static void check_linked(const IntrusiveListHook* hook) {
+        if constexpr (Safe) {
+            if (!hook->is_linked()) throw std::logic_error("IntrusiveList: object is not linked");
+        }
+    }
+
+    static void link_before(IntrusiveListHook* pos, IntrusiveListHook* first, IntrusiveListHook* last) noexcept {
+        first->prev = pos->prev;
+        last->next = pos;
+        pos->prev->next = first;
+        pos->prev = last;
+    }
+
+    static void unlink(IntrusiveListHook* first, IntrusiveListHook* last) noexcept {
+        first->prev->next = last->next;
+        last->next->prev = first->prev;
+    }
+
+    static void reset(IntrusiveListHook* hook) noexcept {
+        hook->next = nullptr;
+        hook->prev = nullptr;
+    }
+
+    void make_empty() noexcept {
+        root.next = &root;
+        root.prev = &root;
+        current_size = 0;
+    }
+
+    // Переносит кольцо other под свою заглушку
+    void take(IntrusiveList& other) noexcept {
+        if (other.empty()) {
+            make_empty();
+            return;
+        }
+        root.next = other.root.next;
+        root.prev = other.root.prev;
+        root.next->prev = &root;
+        root.prev->next = &root;
+        current_size = other.current_size;
+        other.make_empty();
+    }
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using size_type = size_t;
+    using iterator = IntrusiveListIterator<T, Hook, false>;
+    using const_iterator = IntrusiveListIterator<T, Hook, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    IntrusiveList() noexcept {
+        make_empty();
+    }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    IntrusiveList(IntrusiveList&& other) noexcept {
+        take(other);
+    }
+
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            take(other);
+        }
+        return *this;
+    }
+
+    ~IntrusiveList() {
+        clear();
+    }
+
+    T& front() {
+        if (empty()) throw std::out_of_range("IntrusiveList is empty");
+        return *begin();
+    }
+
+    const T& front() const {
+        if (empty()) throw std::out_of_range("IntrusiveList is empty");
+        return *begin();
+    }
+
+    T& back() {
+        if (empty()) throw std::out_of_range("IntrusiveList is empty");
+        return *std::prev(end());
+    }
+
+    const T& back() const {
+        if (empty()) throw std::out_of_range("IntrusiveList is empty");
+        return *std::prev(end());
+    }
+
+    iterator begin() noexcept { return iterator(root.next); }
+    const_iterator begin() const noexcept { return const_iterator(root.next); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(&root); }
+    const_iterator end() const noexcept { return const_iterator(const_cast<IntrusiveListHook*>(&root)); }
+    const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    bool empty() const noexcept { return current_size == 0; }
+    size_t size() const noexcept { return current_size; }
+
+    static bool is_linked(const T& value) noexcept {
+        return (value.*Hook).is_linked();
+    }
+
+    // Итератор на объект, который уже лежит в этом списке, — без поиска
+    iterator iterator_to(T& value) {
+        check_linked(hook_of(value));
+        return iterator(hook_of(value));
+    }
+
+    const_iterator iterator_to(const T& value) const {
+        IntrusiveListHook* hook = const_cast<IntrusiveListHook*>(&(value.*Hook));
+        check_linked(hook);
+        return const_iterator(hook);
+    }
+
+    // Отвязывает все хуки; сами объекты не трогаются
+    void clear() noexcept {
+        for (IntrusiveListHook* hook = root.next; hook != &root;) {
+            IntrusiveListHook* next = hook->next;
+            reset(hook);
+            hook = next;
+        }
+        make_empty();
+    }
+
+    iterator insert(const_iterator pos, T& value) {
+        IntrusiveListHook* hook = hook_of(value);
+        check_unlinked(hook);
+        link_before(pos.hook_, hook, hook);
+        ++current_size;
+        return iterator(hook);
+    }
+
+    void push_back(T& value) {
+        insert(end(), value);
+    }
+
+    void push_front(T& value) {
+        insert(begin(), value);
+    }
+
+    iterator erase(const_iterator pos) {
+        if (pos == end()) return end();
+        IntrusiveListHook* hook = pos.hook_;
+        check_linked(hook);
+        IntrusiveListHook* next = hook->next;
+        unlink(hook, hook);
+        reset(hook);
+        --current_size;
+        return iterator(next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        while (first != last) first = erase(first);
+        return iterator(last.hook_);
+    }
+
+    // O(1): соседи известны из хука самого объекта. Объект должен лежать именно в этом списке
+    void unlink(T& value) {
+        erase(const_iterator(hook_of(value)));
+    }
+
+    void pop_back() {
+        if (!empty()) erase(std::prev(end()));
+    }
+
+    void pop_front() {
+        if (!empty()) erase(begin());
+    }
+
+    void swap(IntrusiveList& other) noexcept {
+        IntrusiveList tmp(std::move(other));
+        other.take(*this);
+        take(tmp);
+    }
+
+    void splice(const_iterator pos, IntrusiveList& other) noexcept {
+        if (&other == this || other.empty()) return;
+        IntrusiveListHook* first = other.root.next;
+        IntrusiveListHook* last = other.root.prev;
+        size_t count = other.current_size;
+        other.make_empty();
+        link_before(pos.hook_, first, last);
+        current_size += count;
+    }
+
+    void splice(const_iterator pos, IntrusiveList&& other) noexcept {
+        splice(pos, other);
+    }
+
+    void splice(const_iterator pos, IntrusiveList& other, const_iterator it) noexcept {
+        IntrusiveListHook* hook = it.hook_;
+        if (&other == this && (hook == pos.hook_ || hook->next == pos.hook_)) return;
+        unlink(hook, hook);
+        --other.current_size;
+        link_before(pos.hook_, hook, hook);
+        ++current_size;
+    }
+
+    void splice(const_iterator pos, IntrusiveList&& other, const_iterator it) noexcept {
+        splice(pos, other, it);
+    }
+
+    // Между разными списками — O(длины диапазона) на пересчёт размера, внутри одного — O(1).
+    // pos не должен лежать внутри [first, last).
+    void splice(const_iterator pos, IntrusiveList& other, const_iterator first, const_iterator last) noexcept {
+        if (first == last) return;
+        if (&other != this) {
+            size_t count = static_cast<size_t>(std::distance(first, last));
+            other.current_size -= count;
+            current_size += count;
+        } else if (pos == last) {
+            return;
+        }
+        IntrusiveListHook* first_hook = first.hook_;
+        IntrusiveListHook* last_hook = last.hook_->prev;
+        unlink(first_hook, last_hook);
+        link_before(pos.hook_, first_hook, last_hook);
+    }
+
+    void splice(const_iterator pos, IntrusiveList&& other, const_iterator first, const_iterator last) noexcept {
+        splice(pos, other, first, last);
+    }
+};
+
+}  // namespace my_container
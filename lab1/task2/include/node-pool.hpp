@@ -0,0 +1,234 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace my_container::detail {
+
+// Пул узлов из слэбов фиксированного размера, выровненных по этому размеру: слэб узла находится маской адреса.
+// У каждого слэба свой список свободных узлов и счётчик выданных, так что узел можно вернуть без доступа к
+// владельцу, а опустевший слэб сразу уходит обратно в аллокатор (кроме одного запасного).
+// Пул принадлежит одному списку и живёт, пока жив этот список или не вернулись выданные узлы
+// (после splice они могут жить в другом списке). Не потокобезопасен.
+template <typename Node, typename Alloc>
+class NodePool {
+public:
+    static constexpr size_t slab_bytes = std::bit_ceil(std::max<size_t>(16384, 64 * sizeof(Node)));
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    struct Slab {
+        NodePool* pool;
+        Slab* prev;
+        Slab* next;
+        FreeNode* free;
+        size_t live;
+        size_t carved;
+    };
+
+    struct alignas(slab_bytes) SlabStorage {
+        std::byte bytes[slab_bytes];
+    };
+
+    using SlabAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<SlabStorage>;
+    using SlabTraits = std::allocator_traits<SlabAlloc>;
+    using PoolAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<NodePool>;
+    using PoolTraits = std::allocator_traits<PoolAlloc>;
+
+    static constexpr size_t first_node = (sizeof(Slab) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+
+    static_assert(sizeof(Node) >= sizeof(FreeNode) && alignof(Node) >= alignof(FreeNode));
+
+public:
+    static constexpr size_t nodes_per_slab = (slab_bytes - first_node) / sizeof(Node);
+
+private:
+    [[no_unique_address]] SlabAlloc alloc_;
+    Slab* available_ = nullptr;
+    Slab* full_ = nullptr;
+    Slab* spare_ = nullptr;
+    size_t slab_count_ = 0;
+    size_t live_ = 0;
+    bool owned_ = true;
+
+    static Slab* slab_of(Node* node) noexcept {
+        return reinterpret_cast<Slab*>(reinterpret_cast<std::uintptr_t>(node) & ~(slab_bytes - 1));
+    }
+
+    static Node* node_at(Slab* slab, size_t index) noexcept {
+        return reinterpret_cast<Node*>(reinterpret_cast<std::byte*>(slab) + first_node + index * sizeof(Node));
+    }
+
+    static bool is_full(const Slab* slab) noexcept {
+        return !slab->free && slab->carved == nodes_per_slab;
+    }
+
+    static void link(Slab*& list, Slab* slab) noexcept {
+        slab->prev = nullptr;
+        slab->next = list;
+        if (list) list->prev = slab;
+        list = slab;
+    }
+
+    static void unlink(Slab*& list, Slab* slab) noexcept {
+        if (slab->prev) {
+            slab->prev->next = slab->next;
+        } else {
+            list = slab->next;
+        }
+        if (slab->next) slab->next->prev = slab->prev;
+    }
+
+    Slab* new_slab() {
+        SlabStorage* storage = SlabTraits::allocate(alloc_, 1);
+        Slab* slab = ::new (static_cast<void*>(storage)) Slab{this, nullptr, nullptr, nullptr, 0, 0};
+        ++slab_count_;
+        link(available_, slab);
+        return slab;
+    }
+
+    void free_slab(Slab* slab) noexcept {
+        if (spare_ == slab) spare_ = nullptr;
+        --slab_count_;
+        SlabTraits::deallocate(alloc_, reinterpret_cast<SlabStorage*>(slab), 1);
+    }
+
+    void free_slabs(Slab* slab, const Slab* keep) noexcept {
+        while (slab) {
+            Slab* next = slab->next;
+            if (slab != keep) free_slab(slab);
+            slab = next;
+        }
+    }
+
+    void destroy_self() noexcept {
+        PoolAlloc alloc(alloc_);
+        std::destroy_at(this);
+        PoolTraits::deallocate(alloc, this, 1);
+    }
+
+    // Пустой слэб нарезается заново с начала; в запасе держим не больше одного
+    void retire(Slab* slab) noexcept {
+        slab->free = nullptr;
+        slab->carved = 0;
+        if (owned_ && (!spare_ || spare_ == slab)) {
+            spare_ = slab;
+            return;
+        }
+        unlink(available_, slab);
+        free_slab(slab);
+        if (!owned_ && slab_count_ == 0) destroy_self();
+    }
+
+    void release_node(Slab* slab, Node* node) noexcept {
+        bool was_full = is_full(slab);
+        slab->free = ::new (static_cast<void*>(node)) FreeNode{slab->free};
+        --slab->live;
+        --live_;
+        if (was_full) {
+            unlink(full_, slab);
+            link(available_, slab);
+        }
+        if (slab->live == 0) retire(slab);
+    }
+
+public:
+    explicit NodePool(const Alloc& alloc) : alloc_(alloc) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    static NodePool* create(const Alloc& alloc) {
+        PoolAlloc pool_alloc(alloc);
+        NodePool* pool = PoolTraits::allocate(pool_alloc, 1);
+        std::construct_at(pool, alloc);
+        return pool;
+    }
+
+    // Возвращает неинициализированную память под узел
+    Node* allocate() {
+        Slab* slab = available_ ? available_ : new_slab();
+        if (slab == spare_) spare_ = nullptr;
+        Node* node;
+        if (FreeNode* free = slab->free) {
+            slab->free = free->next;
+            node = reinterpret_cast<Node*>(free);
+        } else {
+            node = node_at(slab, slab->carved++);
+        }
+        ++slab->live;
+        ++live_;
+        if (is_full(slab)) {
+            unlink(available_, slab);
+            link(full_, slab);
+        }
+        return node;
+    }
+
+    // Узел из ещё не нарезанного хвоста слэба, свободные узлы не используются. Вызовы подряд с prev,
+    // равным предыдущему результату, дают узлы, лежащие в памяти друг за другом (в пределах слэба).
+    Node* allocate_after(Node* prev) {
+        Slab* slab = prev ? slab_of(prev) : nullptr;
+        if (!slab || slab->pool != this || slab->carved == nodes_per_slab) {
+            slab = available_ && available_->carved < nodes_per_slab ? available_ : new_slab();
+        }
+        if (slab == spare_) spare_ = nullptr;
+        Node* node = node_at(slab, slab->carved++);
+        ++slab->live;
+        ++live_;
+        if (is_full(slab)) {
+            unlink(available_, slab);
+            link(full_, slab);
+        }
+        return node;
+    }
+
+    // Узел (уже уничтоженный) возвращается в свой слэб, какому бы пулу тот ни принадлежал
+    static void deallocate(Node* node) noexcept {
+        Slab* slab = slab_of(node);
+        slab->pool->release_node(slab, node);
+    }
+
+    // Забирает память всех выданных узлов разом и оставляет один слэб в запасе.
+    // Вызывающий гарантирует, что все узлы уже уничтожены и больше не используются.
+    void reset() noexcept {
+        Slab* keep = available_ ? available_ : full_;
+        free_slabs(available_, keep);
+        free_slabs(full_, keep);
+        available_ = full_ = nullptr;
+        live_ = 0;
+        if (keep) {
+            keep->free = nullptr;
+            keep->live = 0;
+            keep->carved = 0;
+            link(available_, keep);
+            spare_ = keep;
+        }
+    }
+
+    // Владелец уходит: запасной слэб освобождается, а сам пул — когда вернутся все узлы
+    void release() noexcept {
+        owned_ = false;
+        if (Slab* spare = spare_) {
+            unlink(available_, spare);
+            free_slab(spare);
+        }
+        if (slab_count_ == 0) destroy_self();
+    }
+
+    size_t live() const noexcept {
+        return live_;
+    }
+
+    size_t slab_count() const noexcept {
+        return slab_count_;
+    }
+};
+
+}  // namespace my_container::detail
@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace my_container {
+
+// Сколько элементов вперёд смотрит обход с предвыборкой, если не сказано иное
+inline constexpr size_t default_prefetch_distance = 8;
+
+namespace detail {
+
+// Только подсказка процессору: адрес не разыменовывается, поэтому годится и устаревший указатель
+inline void prefetch(const void* address) noexcept {
+#if defined(__GNUC__)
+    __builtin_prefetch(address, 0, 3);
+#else
+    (void)address;
+#endif
+}
+
+}  // namespace detail
+
+// Обёртка над прямым итератором: второй итератор идёт на distance элементов впереди и запрашивает
+// предвыборку своего элемента, пока обрабатывается текущий. Для узловых контейнеров ведущий итератор сам
+// проходит ту же цепочку указателей, так что выигрыш есть, когда работа над элементом сравнима с промахом;
+// разорвать зависимость между промахами позволяют только ссылки skip у List<..., true>.
+template <std::forward_iterator It>
+class PrefetchIterator {
+private:
+    It current_{};
+    It lead_{};
+    It last_{};
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::iter_value_t<It>;
+    using difference_type = std::iter_difference_t<It>;
+    using reference = std::iter_reference_t<It>;
+
+    PrefetchIterator() = default;
+
+    PrefetchIterator(It first, It last, size_t distance) : current_(first), lead_(first), last_(last) {
+        for (size_t i = 0; i < distance && lead_ != last_; ++i) {
+            ++lead_;
+            if (lead_ != last_) detail::prefetch(std::addressof(*lead_));
+        }
+    }
+
+    reference operator*() const {
+        return *current_;
+    }
+
+    auto operator->() const {
+        return std::addressof(*current_);
+    }
+
+    PrefetchIterator& operator++() {
+        ++current_;
+        if (lead_ != last_ && ++lead_ != last_) detail::prefetch(std::addressof(*lead_));
+        return *this;
+    }
+
+    PrefetchIterator operator++(int) {
+        PrefetchIterator copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    It base() const {
+        return current_;
+    }
+
+    bool operator==(const PrefetchIterator& other) const {
+        return current_ == other.current_;
+    }
+};
+
+template <std::forward_iterator It>
+class PrefetchRange {
+private:
+    It first_;
+    It last_;
+    size_t distance_;
+
+public:
+    PrefetchRange(It first, It last, size_t distance) : first_(first), last_(last), distance_(distance) {}
+
+    PrefetchIterator<It> begin() const {
+        return PrefetchIterator<It>(first_, last_, distance_);
+    }
+
+    PrefetchIterator<It> end() const {
+        return PrefetchIterator<It>(last_, last_, 0);
+    }
+};
+
+// for (auto& x : prefetching(list, 8)) — обход с ведущим итератором
+template <typename Range>
+auto prefetching(Range& range, size_t distance = default_prefetch_distance) {
+    return PrefetchRange(std::begin(range), std::end(range), distance);
+}
+
+// Если контейнер умеет обходить себя с предвыборкой сам (List со ссылками skip), обход делегируется ему
+template <typename Range, typename F>
+void for_each_prefetch(Range& range, F f, size_t distance = default_prefetch_distance) {
+    if constexpr (requires { range.for_each_prefetch(f, distance); }) {
+        range.for_each_prefetch(f, distance);
+    } else {
+        for (auto&& value : prefetching(range, distance)) f(value);
+    }
+}
+
+}  // namespace my_container
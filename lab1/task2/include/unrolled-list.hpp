@@ -0,0 +1,604 @@
+#pragma once
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../../task1/include/container.hpp"
+#include "node-pool.hpp"
+
+namespace my_container {
+
+namespace detail {
+
+inline constexpr size_t cache_line_size = 64;
+
+// Узел занимает одну-две кэш-линии: заголовок и до capacity элементов, живые лежат в слотах [begin, end)
+template <typename T>
+struct alignas(std::max(alignof(T), cache_line_size)) UnrolledNode {
+    static constexpr size_t header_bytes =
+        (2 * sizeof(void*) + 2 * sizeof(uint32_t) + alignof(T) - 1) / alignof(T) * alignof(T);
+    static constexpr size_t capacity = std::max<size_t>(4, (2 * cache_line_size - header_bytes) / sizeof(T));
+
+    UnrolledNode* next = nullptr;
+    UnrolledNode* prev = nullptr;
+    uint32_t begin = 0;
+    uint32_t end = 0;
+    alignas(T) std::byte storage[capacity * sizeof(T)];
+
+    T* slot(size_t index) noexcept {
+        return reinterpret_cast<T*>(storage) + index;
+    }
+
+    size_t size() const noexcept {
+        return end - begin;
+    }
+};
+
+}  // namespace detail
+
+template <typename T, size_t N, typename Alloc>
+class UnrolledList;
+
+// Позиция — узел и номер слота в нём; end() устроен так же, как у ListIterator
+template <typename T, bool Const>
+class UnrolledListIterator {
+private:
+    using Node = detail::UnrolledNode<T>;
+
+    Node* node_ = nullptr;
+    size_t index_ = 0;
+    Node* const* tail_ = nullptr;
+
+    template <typename, size_t, typename>
+    friend class UnrolledList;
+    friend class UnrolledListIterator<T, !Const>;
+
+    UnrolledListIterator(Node* node, size_t index, Node* const* tail) noexcept
+        : node_(node), index_(index), tail_(tail) {}
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    UnrolledListIterator() = default;
+
+    template <bool OtherConst>
+        requires(Const && !OtherConst)
+    UnrolledListIterator(const UnrolledListIterator<T, OtherConst>& other) noexcept
+        : node_(other.node_), index_(other.index_), tail_(other.tail_) {}
+
+    reference operator*() const {
+        return *node_->slot(index_);
+    }
+
+    pointer operator->() const {
+        return node_->slot(index_);
+    }
+
+    UnrolledListIterator& operator++() {
+        if (++index_ == node_->end) {
+            node_ = node_->next;
+            index_ = node_ ? node_->begin : 0;
+        }
+        return *this;
+    }
+
+    UnrolledListIterator operator++(int) {
+        UnrolledListIterator copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    UnrolledListIterator& operator--() {
+        if (!node_ || index_ == node_->begin) {
+            node_ = node_ ? node_->prev : *tail_;
+            index_ = node_->end;
+        }
+        --index_;
+        return *this;
+    }
+
+    UnrolledListIterator operator--(int) {
+        UnrolledListIterator copy = *this;
+        --*this;
+        return copy;
+    }
+
+    template <bool OtherConst>
+    bool operator==(const UnrolledListIterator<T, OtherConst>& other) const noexcept {
+        return node_ == other.node_ && index_ == other.index_;
+    }
+};
+
+// Развёрнутый список: тот же интерфейс, что у List, но в каждом узле до node_capacity элементов подряд.
+// push/pop с концов не двигают элементы и не портят итераторы (кроме end() после перемещения списка);
+// insert и erase сдвигают элементы внутри узла, а при делении или слиянии узлов — и в соседнем,
+// поэтому итераторы на затронутые узлы становятся недействительными.
+template <typename T, size_t N = 0, typename Alloc = std::allocator<T>>
+class UnrolledList : public Container<T, N, UnrolledListIterator<T, false>, UnrolledListIterator<T, true>> {
+private:
+    using Node = detail::UnrolledNode<T>;
+
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
+    using NodePool = detail::NodePool<Node, NodeAlloc>;
+
+    Node* head = nullptr;
+    Node* tail = nullptr;
+    size_t current_size = 0;
+    [[no_unique_address]] NodeAlloc node_alloc;
+    // Узлы берутся слэбами, как у List: соседние узлы оказываются рядом в памяти
+    NodePool* node_pool = nullptr;
+
+    static void relocate(T* first, T* last, T* dest) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move(first, last, dest);
+        } else {
+            std::uninitialized_copy(first, last, dest);
+        }
+    }
+
+    static void destroy_elements(Node* node) noexcept {
+        for (size_t i = node->end; i > node->begin;) std::destroy_at(node->slot(--i));
+    }
+
+    // Пустой узел со слотами, начинающимися с at, вставляется после prev (nullptr — в начало)
+    Node* create_node(Node* prev, uint32_t at) {
+        if (!node_pool) node_pool = NodePool::create(node_alloc);
+        Node* node = node_pool->allocate();
+        ::new (static_cast<void*>(node)) Node;
+        node->begin = node->end = at;
+        node->prev = prev;
+        node->next = prev ? prev->next : head;
+        if (node->next) {
+            node->next->prev = node;
+        } else {
+            tail = node;
+        }
+        if (prev) {
+            prev->next = node;
+        } else {
+            head = node;
+        }
+        return node;
+    }
+
+    // Элементы узла уже уничтожены
+    void destroy_node(Node* node) noexcept {
+        if (node->prev) {
+            node->prev->next = node->next;
+        } else {
+            head = node->next;
+        }
+        if (node->next) {
+            node->next->prev = node->prev;
+        } else {
+            tail = node->prev;
+        }
+        std::destroy_at(node);
+        NodePool::deallocate(node);
+    }
+
+    void release_pool() noexcept {
+        if (node_pool) node_pool->release();
+        node_pool = nullptr;
+    }
+
+    // Переносит верхнюю половину полного узла в новый узел сразу за ним
+    void split(Node* node) {
+        Node* fresh = create_node(node, 0);
+        size_t mid = node->begin + node->size() / 2;
+        try {
+            relocate(node->slot(mid), node->slot(node->end), fresh->slot(0));
+        } catch (...) {
+            destroy_node(fresh);
+            throw;
+        }
+        fresh->end = static_cast<uint32_t>(node->end - mid);
+        for (size_t i = node->end; i > mid;) std::destroy_at(node->slot(--i));
+        node->end = static_cast<uint32_t>(mid);
+    }
+
+    // Сдвигает живые элементы узла к нулевому слоту
+    static void compact(Node* node) {
+        size_t shift = node->begin;
+        if (shift == 0) return;
+        size_t count = node->size();
+        for (size_t i = 0; i < count; ++i) {
+            T* from = node->slot(shift + i);
+            if (i < shift) {
+                std::construct_at(node->slot(i), std::move(*from));
+            } else {
+                *node->slot(i) = std::move(*from);
+            }
+        }
+        for (size_t i = node->end; i > std::max(count, shift);) std::destroy_at(node->slot(--i));
+        node->begin = 0;
+        node->end = static_cast<uint32_t>(count);
+    }
+
+    // Вставляет value на место слота index (index < node->end), сдвигая более короткую сторону узла
+    UnrolledListIterator<T, false> insert_value(Node* node, size_t index, T&& value) {
+        if (node->size() == Node::capacity) {
+            split(node);
+            if (index > node->end) {
+                index -= node->end;
+                node = node->next;
+            }
+        }
+        T* s = node->slot(0);
+        size_t first = node->begin;
+        size_t last = node->end;
+        bool to_right = last < Node::capacity && (first == 0 || last - index <= index - first);
+        if (to_right) {
+            if (index == last) {
+                std::construct_at(s + last, std::move(value));
+            } else {
+                std::construct_at(s + last, std::move(s[last - 1]));
+                std::move_backward(s + index, s + last - 1, s + last);
+                s[index] = std::move(value);
+            }
+            ++node->end;
+        } else {
+            if (index == first) {
+                std::construct_at(s + first - 1, std::move(value));
+            } else {
+                std::construct_at(s + first - 1, std::move(s[first]));
+                std::move(s + first + 1, s + index, s + first);
+                s[index - 1] = std::move(value);
+            }
+            --node->begin;
+            --index;
+        }
+        ++current_size;
+        return UnrolledListIterator<T, false>(node, index, &tail);
+    }
+
+    // Дописывает элементы следующего узла в node (после сдвига к нулевому слоту) и освобождает его
+    void absorb_next(Node* node) {
+        Node* next = node->next;
+        compact(node);
+        relocate(next->slot(next->begin), next->slot(next->end), node->slot(node->end));
+        node->end += static_cast<uint32_t>(next->size());
+        destroy_elements(next);
+        destroy_node(next);
+    }
+
+    // После удаления: index == node->end означает первый элемент следующего узла.
+    // Опустевший узел освобождается, а почти пустой сливается с соседом, если вместе они занимают
+    // не больше половины узла.
+    UnrolledListIterator<T, false> settle(Node* node, size_t index) {
+        if (node->size() == 0) {
+            Node* next = node->next;
+            destroy_node(node);
+            return UnrolledListIterator<T, false>(next, next ? next->begin : 0, &tail);
+        }
+        auto fits = [](const Node* a, const Node* b) { return b && a->size() + b->size() <= Node::capacity / 2; };
+        Node* into = fits(node, node->next) ? node : fits(node, node->prev) ? node->prev : nullptr;
+        if (into) {
+            size_t offset = index - node->begin;
+            size_t base = into == node ? 0 : into->size();
+            absorb_next(into);
+            node = into;
+            index = base + offset;
+        }
+        if (index == node->end) {
+            node = node->next;
+            index = node ? node->begin : 0;
+        }
+        return UnrolledListIterator<T, false>(node, index, &tail);
+    }
+
+    void copy_from(const UnrolledList& other) {
+        for (const T& value : other) push_back(value);
+    }
+
+public:
+    using allocator_type = Alloc;
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using size_type = size_t;
+    using iterator = UnrolledListIterator<T, false>;
+    using const_iterator = UnrolledListIterator<T, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using container_type = Container<T, N, iterator, const_iterator>;
+
+    static constexpr size_t node_capacity = Node::capacity;
+
+    UnrolledList() = default;
+
+    explicit UnrolledList(const Alloc& alloc) : node_alloc(alloc) {}
+
+    UnrolledList(const UnrolledList& other)
+        : UnrolledList(Alloc(NodeAllocTraits::select_on_container_copy_construction(other.node_alloc))) {
+        copy_from(other);
+    }
+
+    UnrolledList(UnrolledList&& other) noexcept
+        : head(std::exchange(other.head, nullptr)),
+          tail(std::exchange(other.tail, nullptr)),
+          current_size(std::exchange(other.current_size, 0)),
+          node_alloc(std::move(other.node_alloc)),
+          node_pool(std::exchange(other.node_pool, nullptr)) {}
+
+    UnrolledList(std::initializer_list<T> init, const Alloc& alloc = Alloc()) : UnrolledList(alloc) {
+        for (const auto& item : init) push_back(item);
+    }
+
+    virtual ~UnrolledList() {
+        clear();
+        release_pool();
+    }
+
+    UnrolledList& operator=(const UnrolledList& other) {
+        if (this != &other) {
+            clear();
+            if constexpr (NodeAllocTraits::propagate_on_container_copy_assignment::value) {
+                if (node_alloc != other.node_alloc) release_pool();
+                node_alloc = other.node_alloc;
+            }
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    UnrolledList& operator=(const container_type& other) override {
+        if (this == &other) return *this;
+        const UnrolledList* other_list = dynamic_cast<const UnrolledList*>(&other);
+        if (!other_list) {
+            throw std::invalid_argument("Container type mismatch in assignment");
+        }
+        clear();
+        copy_from(*other_list);
+        return *this;
+    }
+
+    UnrolledList& operator=(UnrolledList&& other) noexcept(NodeAllocTraits::propagate_on_container_move_assignment::value ||
+                                                           NodeAllocTraits::is_always_equal::value) {
+        if (this != &other) {
+            clear();
+            if constexpr (!NodeAllocTraits::propagate_on_container_move_assignment::value &&
+                          !NodeAllocTraits::is_always_equal::value) {
+                if (node_alloc != other.node_alloc) {
+                    for (T& value : other) push_back(std::move(value));
+                    other.clear();
+                    return *this;
+                }
+            }
+            if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::value) {
+                node_alloc = std::move(other.node_alloc);
+            }
+            release_pool();
+            node_pool = std::exchange(other.node_pool, nullptr);
+            head = std::exchange(other.head, nullptr);
+            tail = std::exchange(other.tail, nullptr);
+            current_size = std::exchange(other.current_size, 0);
+        }
+        return *this;
+    }
+
+    T& front() {
+        if (empty()) throw std::out_of_range("UnrolledList is empty");
+        return *head->slot(head->begin);
+    }
+
+    const T& front() const {
+        if (empty()) throw std::out_of_range("UnrolledList is empty");
+        return *head->slot(head->begin);
+    }
+
+    T& back() {
+        if (empty()) throw std::out_of_range("UnrolledList is empty");
+        return *tail->slot(tail->end - 1);
+    }
+
+    const T& back() const {
+        if (empty()) throw std::out_of_range("UnrolledList is empty");
+        return *tail->slot(tail->end - 1);
+    }
+
+    iterator begin() override {
+        return iterator(head, head ? head->begin : 0, &tail);
+    }
+
+    const_iterator begin() const override {
+        return const_iterator(head, head ? head->begin : 0, &tail);
+    }
+
+    const_iterator cbegin() const override {
+        return begin();
+    }
+
+    iterator end() override {
+        return iterator(nullptr, 0, &tail);
+    }
+
+    const_iterator end() const override {
+        return const_iterator(nullptr, 0, &tail);
+    }
+
+    const_iterator cend() const override {
+        return end();
+    }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    allocator_type get_allocator() const { return Alloc(node_alloc); }
+
+    bool empty() const override { return current_size == 0; }
+    size_t size() const override { return current_size; }
+    size_t max_size() const override { return current_size; }
+
+    // Число узлов, O(узлов); нужно для оценки заполненности
+    size_t node_count() const noexcept {
+        size_t count = 0;
+        for (const Node* node = head; node; node = node->next) ++count;
+        return count;
+    }
+
+    void clear() {
+        while (head) {
+            destroy_elements(head);
+            destroy_node(head);
+        }
+        current_size = 0;
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        Node* node = tail && tail->end < Node::capacity ? tail : create_node(tail, 0);
+        try {
+            std::construct_at(node->slot(node->end), std::forward<Args>(args)...);
+        } catch (...) {
+            if (node->size() == 0) destroy_node(node);
+            throw;
+        }
+        ++current_size;
+        return *node->slot(node->end++);
+    }
+
+    void pop_back() {
+        if (empty()) return;
+        std::destroy_at(tail->slot(--tail->end));
+        if (tail->size() == 0) destroy_node(tail);
+        --current_size;
+    }
+
+    void push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    // Новый головной узел заполняется с конца, чтобы следующие push_front тоже ничего не сдвигали
+    template <typename... Args>
+    T& emplace_front(Args&&... args) {
+        Node* node = head && head->begin > 0 ? head : create_node(nullptr, Node::capacity);
+        try {
+            std::construct_at(node->slot(node->begin - 1), std::forward<Args>(args)...);
+        } catch (...) {
+            if (node->size() == 0) destroy_node(node);
+            throw;
+        }
+        ++current_size;
+        return *node->slot(--node->begin);
+    }
+
+    void pop_front() {
+        if (empty()) return;
+        std::destroy_at(head->slot(head->begin++));
+        if (head->size() == 0) destroy_node(head);
+        --current_size;
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    // В конец строит на месте; в середине значение сначала собирается отдельно и затем перемещается в
+    // освобождённый сдвигом слот — args могут ссылаться на элементы этого же узла
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        if (pos == end()) {
+            emplace_back(std::forward<Args>(args)...);
+            return iterator(tail, tail->end - 1, &tail);
+        }
+        return insert_value(pos.node_, pos.index_, T(std::forward<Args>(args)...));
+    }
+
+    iterator erase(const_iterator pos) {
+        if (pos == end()) return end();
+        Node* node = pos.node_;
+        size_t index = pos.index_;
+        T* s = node->slot(0);
+        if (index - node->begin < node->end - 1 - index) {
+            std::move_backward(s + node->begin, s + index, s + index + 1);
+            std::destroy_at(s + node->begin++);
+            ++index;
+        } else {
+            std::move(s + index + 1, s + node->end, s + index);
+            std::destroy_at(s + --node->end);
+        }
+        --current_size;
+        return settle(node, index);
+    }
+
+    void resize(size_t count) {
+        while (current_size > count) pop_back();
+        while (current_size < count) emplace_back();
+    }
+
+    void swap(UnrolledList& other) noexcept {
+        if constexpr (NodeAllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(node_alloc, other.node_alloc);
+        }
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(current_size, other.current_size);
+        std::swap(node_pool, other.node_pool);
+    }
+
+    bool operator==(const container_type& other) const override {
+        const UnrolledList& other_list = static_cast<const UnrolledList&>(other);
+        return size() == other_list.size() && std::equal(begin(), end(), other_list.begin());
+    }
+
+    bool operator!=(const container_type& other) const override {
+        return !(*this == other);
+    }
+
+    bool operator<(const UnrolledList& other) const {
+        return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+    }
+
+    bool operator<=(const UnrolledList& other) const {
+        return !(other < *this);
+    }
+
+    bool operator>(const UnrolledList& other) const {
+        return other < *this;
+    }
+
+    bool operator>=(const UnrolledList& other) const {
+        return !(*this < other);
+    }
+
+    auto operator<=>(const UnrolledList& other) const {
+        return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
+    }
+};
+
+}  // namespace my_container
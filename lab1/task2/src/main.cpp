@@ -15,22 +15,20 @@ int main() {
         std::cout << "Первый элемент: " << myList.front() << std::endl;
         std::cout << "Последний элемент: " << myList.back() << std::endl;
 
-        auto pos = myList.begin();
-        pos = myList.next(pos);
+        auto pos = std::next(myList.begin());
         myList.insert(pos, 15);
 
         std::cout << "Элементы списка: ";
-        for (auto it = myList.begin(); it != myList.end(); it = myList.next(it)) {
-            std::cout << *it << " ";
+        for (int value : myList) {
+            std::cout << value << " ";
         }
         std::cout << std::endl;
 
-        pos = myList.next(myList.begin());
-        myList.erase(pos);
+        myList.erase(std::next(myList.begin()));
 
         std::cout << "Элементы после удаления: ";
-        for (auto it = myList.begin(); it != myList.end(); it = myList.next(it)) {
-            std::cout << *it << " ";
+        for (int value : myList) {
+            std::cout << value << " ";
         }
         std::cout << std::endl;
 
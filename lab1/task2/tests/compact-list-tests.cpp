@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include "../include/compact-list.hpp"
+#include "../../task1/include/allocators.hpp"
+#include "../../task1/tests/test-utils.hpp"
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace my_container;
+using test_utils::to_vector;
+
+TEST(CompactListTest, SlotsUse32BitLinks) {
+    EXPECT_EQ(CompactList<int>::slot_size, 12);
+    EXPECT_EQ(CompactList<long>::slot_size, 16);
+    static_assert(std::bidirectional_iterator<CompactList<int>::iterator>);
+    static_assert(std::bidirectional_iterator<CompactList<int>::const_iterator>);
+}
+
+TEST(CompactListTest, BasicOperations) {
+    CompactList<int, 5> list = {1, 2, 3};
+    EXPECT_EQ(list.size(), 3);
+    list.push_front(0);
+    list.push_back(4);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 4);
+
+    auto it = list.insert(std::next(list.begin(), 2), 10);
+    EXPECT_EQ(*it, 10);
+    it = list.erase(it);
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(list.erase(list.end()), list.end());
+
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(to_vector(list), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(*std::prev(list.end()), 3);
+    EXPECT_EQ(*list.rbegin(), 3);
+
+    CompactList<int, 5> copy(list);
+    EXPECT_TRUE(copy == list);
+    copy.push_back(9);
+    EXPECT_TRUE(list < copy);
+    EXPECT_TRUE(copy != list);
+
+    CompactList<int, 5> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 4);
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_THROW(moved.front(), std::out_of_range);
+    EXPECT_THROW(moved.back(), std::out_of_range);
+}
+
+TEST(CompactListTest, FreedSlotsAreReused) {
+    CompactList<int> list;
+    for (int i = 0; i < 100; ++i) list.push_back(i);
+    size_t capacity = list.capacity();
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 50; ++i) list.pop_front();
+        for (int i = 0; i < 50; ++i) list.push_back(i);
+    }
+    EXPECT_EQ(list.capacity(), capacity);
+    EXPECT_EQ(list.size(), 100);
+}
+
+TEST(CompactListTest, IteratorsSurviveGrowth) {
+    CompactList<std::string> list;
+    list.push_back("first");
+    auto first = list.begin();
+    for (int i = 0; i < 1000; ++i) list.push_back(std::string(20, static_cast<char>('a' + i % 26)));
+    EXPECT_EQ(*first, "first");
+    EXPECT_EQ(std::distance(first, list.end()), 1001);
+
+    list.push_back(list.front());
+    EXPECT_EQ(list.back(), "first");
+}
+
+TEST(CompactListTest, MatchesStdListUnderRandomEdits) {
+    std::mt19937 gen(17);
+    CompactList<std::string> list;
+    std::list<std::string> model;
+    for (int step = 0; step < 20000; ++step) {
+        std::string value = std::to_string(step);
+        size_t pos = model.empty() ? 0 : gen() % (model.size() + 1);
+        switch (gen() % 4) {
+            case 0:
+                list.push_back(value);
+                model.push_back(value);
+                break;
+            case 1:
+                list.push_front(value);
+                model.push_front(value);
+                break;
+            case 2:
+                list.insert(std::next(list.cbegin(), pos), value);
+                model.insert(std::next(model.cbegin(), pos), value);
+                break;
+            default:
+                if (pos < model.size()) {
+                    list.erase(std::next(list.cbegin(), pos));
+                    model.erase(std::next(model.cbegin(), pos));
+                }
+                break;
+        }
+        ASSERT_EQ(list.size(), model.size());
+    }
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), model.begin(), model.end()));
+    EXPECT_TRUE(std::equal(list.rbegin(), list.rend(), model.rbegin(), model.rend()));
+}
+
+TEST(CompactListTest, SnapshotKeepsSlotLayout) {
+    CompactList<int> live;
+    for (int i = 0; i < 1000; ++i) live.push_back(i);
+    for (auto it = live.begin(); it != live.end();) {
+        it = live.erase(it);
+        if (it != live.end()) ++it;
+    }
+    CompactList<int> snapshot(live);
+    EXPECT_TRUE(snapshot == live);
+    EXPECT_EQ(snapshot.capacity(), live.capacity());
+
+    live.push_back(-1);
+    snapshot.push_back(-1);
+    EXPECT_TRUE(snapshot == live);
+
+    CompactList<int> target;
+    target.reserve(2000);
+    target = live;
+    EXPECT_TRUE(target == live);
+    target.push_front(5);
+    EXPECT_EQ(target.front(), 5);
+    EXPECT_EQ(live.front(), 1);
+
+    const CompactList<int>::container_type& base = live;
+    CompactList<int> other;
+    other = base;
+    EXPECT_TRUE(other == live);
+}
+
+TEST(CompactListTest, AssignSortUniqueReverse) {
+    CompactList<int> list = {0, 0, 0, 0, 0};
+    list.assign(3, 7);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{7, 7, 7}));
+    std::vector<int> source = {5, 3, 3, 1, 4, 1, 5};
+    list.assign(source.begin(), source.end());
+    EXPECT_EQ(to_vector(list), source);
+
+    list.sort();
+    EXPECT_EQ(to_vector(list), (std::vector<int>{1, 1, 3, 3, 4, 5, 5}));
+    EXPECT_EQ(list.unique(), 3);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{1, 3, 4, 5}));
+    list.reverse();
+    EXPECT_EQ(to_vector(list), (std::vector<int>{5, 4, 3, 1}));
+    EXPECT_EQ(*std::prev(list.end()), 1);
+
+    list.resize(6);
+    EXPECT_EQ(list.size(), 6);
+    EXPECT_EQ(list.back(), 0);
+}
+
+TEST(CompactListTest, ArenaAllocator) {
+    Arena arena;
+    CompactList<std::string, 0, ArenaAllocator<std::string>> list({"a", "b"}, ArenaAllocator<std::string>(arena));
+    for (int i = 0; i < 100; ++i) list.push_back(std::to_string(i));
+    CompactList<std::string, 0, ArenaAllocator<std::string>> copy(list);
+    EXPECT_TRUE(copy == list);
+    EXPECT_EQ(&copy.get_allocator().resource(), &arena);
+}
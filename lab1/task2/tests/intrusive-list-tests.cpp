@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include "../include/intrusive-list.hpp"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace my_container;
+
+namespace {
+
+struct Timer {
+    std::string name;
+    int deadline;
+    IntrusiveListHook hook;
+    IntrusiveListHook expired_hook;
+
+    Timer(std::string n, int d) : name(std::move(n)), deadline(d) {}
+};
+
+using Timers = IntrusiveList<Timer, &Timer::hook>;
+using SafeTimers = IntrusiveList<Timer, &Timer::hook, true>;
+using ExpiredTimers = IntrusiveList<Timer, &Timer::expired_hook>;
+
+template <typename L>
+std::vector<std::string> names(const L& list) {
+    std::vector<std::string> result;
+    for (const Timer& timer : list) result.push_back(timer.name);
+    return result;
+}
+
+}  // namespace
+
+TEST(IntrusiveListTest, LinksObjectsInPlace) {
+    static_assert(std::bidirectional_iterator<Timers::iterator>);
+    static_assert(std::bidirectional_iterator<Timers::const_iterator>);
+
+    Timer a("a", 1), b("b", 2), c("c", 3);
+    Timers list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.front(), std::out_of_range);
+
+    list.push_back(b);
+    list.push_front(a);
+    list.push_back(c);
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(&list.front(), &a);
+    EXPECT_EQ(&list.back(), &c);
+    EXPECT_EQ(names(list), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(&*std::prev(list.end()), &c);
+    EXPECT_EQ(list.rbegin()->name, "c");
+
+    EXPECT_TRUE(Timers::is_linked(b));
+    list.unlink(b);
+    EXPECT_FALSE(Timers::is_linked(b));
+    EXPECT_EQ(names(list), (std::vector<std::string>{"a", "c"}));
+
+    auto it = list.insert(list.iterator_to(c), b);
+    EXPECT_EQ(&*it, &b);
+    const Timers& view = list;
+    Timers::const_iterator found = view.iterator_to(static_cast<const Timer&>(b));
+    EXPECT_EQ(&*found, &b);
+    EXPECT_EQ(&*std::next(found), &c);
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(names(list), (std::vector<std::string>{"b"}));
+    EXPECT_FALSE(Timers::is_linked(a));
+}
+
+TEST(IntrusiveListTest, ObjectInTwoListsAtOnce) {
+    std::vector<Timer> pool;
+    for (int i = 0; i < 6; ++i) pool.emplace_back("t" + std::to_string(i), i);
+    Timers active;
+    ExpiredTimers expired;
+    for (Timer& timer : pool) active.push_back(timer);
+    for (Timer& timer : pool) {
+        if (timer.deadline % 2 == 0) expired.push_back(timer);
+    }
+    EXPECT_EQ(active.size(), 6);
+    EXPECT_EQ(expired.size(), 3);
+
+    for (Timer& timer : expired) active.unlink(timer);
+    EXPECT_EQ(names(active), (std::vector<std::string>{"t1", "t3", "t5"}));
+    EXPECT_EQ(names(expired), (std::vector<std::string>{"t0", "t2", "t4"}));
+}
+
+TEST(IntrusiveListTest, ClearAndDestructorUnlinkHooks) {
+    Timer a("a", 1), b("b", 2);
+    {
+        Timers list;
+        list.push_back(a);
+        list.push_back(b);
+    }
+    EXPECT_FALSE(Timers::is_linked(a));
+    EXPECT_FALSE(Timers::is_linked(b));
+
+    Timers list;
+    list.push_back(a);
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(Timers::is_linked(a));
+
+    Timer copy = b;
+    list.push_back(b);
+    EXPECT_FALSE(Timers::is_linked(copy));
+}
+
+TEST(IntrusiveListTest, SpliceMoveAndSwap) {
+    Timer a("a", 1), b("b", 2), c("c", 3), d("d", 4), e("e", 5);
+    Timers first;
+    Timers second;
+    first.push_back(a);
+    first.push_back(e);
+    second.push_back(b);
+    second.push_back(c);
+    second.push_back(d);
+
+    first.splice(first.iterator_to(e), second, second.begin(), second.iterator_to(d));
+    EXPECT_EQ(names(first), (std::vector<std::string>{"a", "b", "c", "e"}));
+    EXPECT_EQ(second.size(), 1);
+
+    first.splice(first.iterator_to(e), second, second.begin());
+    EXPECT_TRUE(second.empty());
+    EXPECT_EQ(first.size(), 5);
+
+    first.splice(first.begin(), first, first.iterator_to(e));
+    EXPECT_EQ(names(first), (std::vector<std::string>{"e", "a", "b", "c", "d"}));
+
+    second.splice(second.end(), first);
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(second.size(), 5);
+
+    Timers moved(std::move(second));
+    EXPECT_TRUE(second.empty());
+    EXPECT_EQ(names(moved), (std::vector<std::string>{"e", "a", "b", "c", "d"}));
+    EXPECT_EQ(&moved.back(), &d);
+
+    moved.unlink(d);
+    first.push_back(d);
+    moved.swap(first);
+    EXPECT_EQ(names(moved), (std::vector<std::string>{"d"}));
+    EXPECT_EQ(names(first), (std::vector<std::string>{"e", "a", "b", "c"}));
+    EXPECT_EQ(&first.back(), &c);
+    EXPECT_EQ(&*std::prev(moved.end()), &d);
+}
+
+TEST(IntrusiveListTest, SafeModeRejectsMisuse) {
+    Timer a("a", 1), b("b", 2);
+    SafeTimers list;
+    list.push_back(a);
+    EXPECT_THROW(list.push_back(a), std::logic_error);
+    EXPECT_THROW(list.push_front(a), std::logic_error);
+    EXPECT_THROW(list.unlink(b), std::logic_error);
+    EXPECT_THROW(list.iterator_to(b), std::logic_error);
+    EXPECT_EQ(list.size(), 1);
+
+    IntrusiveList<Timer, &Timer::hook, false> unchecked;
+    unchecked.push_back(b);
+    EXPECT_EQ(unchecked.size(), 1);
+    unchecked.clear();
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "../include/compact-list.hpp"
+#include "../include/double-linked-list.hpp"
+#include "../include/prefetch.hpp"
+#include "../include/unrolled-list.hpp"
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace my_container;
+
+namespace {
+
+using SkipList = List<int, 0, std::allocator<int>, true>;
+
+template <typename L>
+std::vector<int> visit(L& list, size_t distance) {
+    std::vector<int> seen;
+    for_each_prefetch(list, [&](const int& value) { seen.push_back(value); }, distance);
+    return seen;
+}
+
+}  // namespace
+
+TEST(PrefetchTest, IteratorVisitsEveryElementOnce) {
+    static_assert(std::forward_iterator<PrefetchIterator<List<int>::iterator>>);
+    List<int> list = {1, 2, 3, 4, 5};
+    for (size_t distance : {0, 1, 4, 5, 100}) {
+        std::vector<int> seen;
+        for (int& value : prefetching(list, distance)) seen.push_back(value);
+        EXPECT_EQ(seen, (std::vector<int>{1, 2, 3, 4, 5})) << distance;
+    }
+
+    List<int> empty;
+    auto range = prefetching(empty, 8);
+    EXPECT_EQ(range.begin(), range.end());
+
+    for (int& value : prefetching(list)) value *= 2;
+    EXPECT_EQ(list.back(), 10);
+}
+
+TEST(PrefetchTest, ForEachOverAnyContainer) {
+    std::vector<int> expected(300);
+    for (int i = 0; i < 300; ++i) expected[i] = i;
+
+    List<int> list(expected.begin(), expected.end());
+    UnrolledList<int> unrolled;
+    for (int value : expected) unrolled.push_back(value);
+    CompactList<int> compact(expected.begin(), expected.end());
+    const List<int>& const_list = list;
+    EXPECT_EQ(visit(list, 8), expected);
+    EXPECT_EQ(visit(const_list, 3), expected);
+    EXPECT_EQ(visit(unrolled, 16), expected);
+    EXPECT_EQ(visit(compact, 2), expected);
+    EXPECT_EQ(visit(expected, 4), expected);
+}
+
+TEST(PrefetchTest, SkipLinksFollowAppends) {
+    SkipList list;
+    EXPECT_EQ(list.skip_links_distance(), 0);
+    for (int i = 0; i < 10; ++i) list.push_back(i);
+    list.build_skip_links(4);
+    EXPECT_EQ(list.skip_links_distance(), 4);
+
+    for (int i = 10; i < 20; ++i) list.emplace_back(i);
+    std::vector<int> more = {20, 21, 22};
+    list.bulk_push_back(more.begin(), more.end());
+
+    std::vector<int> expected(23);
+    for (int i = 0; i < 23; ++i) expected[i] = i;
+    EXPECT_EQ(visit(list, 8), expected);
+
+    SkipList copy(list);
+    EXPECT_EQ(copy.skip_links_distance(), 4);
+    EXPECT_EQ(visit(copy, 8), expected);
+    SkipList moved(std::move(copy));
+    EXPECT_EQ(moved.skip_links_distance(), 4);
+
+    list.build_skip_links(0);
+    EXPECT_EQ(visit(list, 8), expected);
+}
+
+TEST(PrefetchTest, StaleSkipLinksAreOnlyHints) {
+    std::mt19937 gen(5);
+    SkipList list;
+    std::vector<int> model;
+    for (int i = 0; i < 2000; ++i) {
+        list.push_back(i);
+        model.push_back(i);
+    }
+    list.build_skip_links(8);
+    for (int step = 0; step < 3000; ++step) {
+        size_t pos = gen() % (model.size() + 1);
+        if (gen() % 2 == 0 && pos < model.size()) {
+            list.erase(std::next(list.cbegin(), static_cast<std::ptrdiff_t>(pos)));
+            model.erase(model.begin() + static_cast<std::ptrdiff_t>(pos));
+        } else {
+            list.insert(std::next(list.cbegin(), static_cast<std::ptrdiff_t>(pos)), -step);
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(pos), -step);
+        }
+    }
+    EXPECT_EQ(visit(list, 8), model);
+
+    list.sort();
+    list.reverse();
+    list.clear();
+    for (int i = 0; i < 100; ++i) list.push_front(i);
+    std::vector<int> seen = visit(list, 8);
+    EXPECT_EQ(seen.size(), 100);
+    EXPECT_EQ(seen.front(), 99);
+}
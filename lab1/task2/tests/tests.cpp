@@ -1,5 +1,17 @@
 #include <gtest/gtest.h>
 #include "../include/double-linked-list.hpp"
+#include "../../task1/include/allocators.hpp"
+#include "../../task1/tests/test-utils.hpp"
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace my_container {
 
@@ -65,7 +77,7 @@ TEST(ListTest, EmptyListAccess) {
 TEST(ListTest, Iterators) {
     List<int, 5> list = {1, 2, 3};
     int sum = 0;
-    for (auto it = list.begin(); it != list.end(); it = list.next(it)) {
+    for (auto it = list.begin(); it != list.end(); ++it) {
         sum += *it;
     }
     EXPECT_EQ(sum, 6);
@@ -78,7 +90,7 @@ TEST(ListTest, Iterators) {
 TEST(ListTest, ReverseIterators) {
     List<int, 5> list = {1, 2, 3};
     int sum = 0;    
-    for (auto it = list.rbegin(); it != list.rend(); it = list.prev(it)) {
+    for (auto it = list.rbegin(); it != list.rend(); ++it) {
         sum += *it;        
     }
     EXPECT_EQ(sum, 6);
@@ -99,13 +111,12 @@ TEST(ListTest, PushPopOperations) {
 TEST(ListTest, InsertErase) {
     List<int, 5> list = {1, 3};
     
-    int* first = list.begin();
-    int* pos = list.begin();
-    pos = list.next(pos);
+    auto first = list.begin();
+    auto pos = std::next(list.begin());
     
     list.insert(pos, 2);
     EXPECT_EQ(list.size(), 3);
-    EXPECT_EQ(*list.next(first), 2);
+    EXPECT_EQ(*std::next(first), 2);
     
     list.erase(pos);
     EXPECT_EQ(list.size(), 2);
@@ -150,18 +161,20 @@ TEST(ListTest, Comparisons) {
 TEST(ListTest, ContainerAssignmentOperator) {
     List<int, 3> list;
     list.push_back(1);
-    const Container<int, 3>& base_ref = list;
+    const List<int, 3>::container_type& base_ref = list;
     list = base_ref;
     EXPECT_EQ(list.size(), 1);
     EXPECT_EQ(list.front(), 1);
 
-    class DummyContainer : public Container<int, 3> { Container& operator=(const Container&) override { return *this; }
-    int* begin() override { return nullptr; }
-    const int* begin() const override { return nullptr; }
-    const int* cbegin() const override { return nullptr; }
-    int* end() override { return nullptr; }
-    const int* end() const override { return nullptr; }
-    const int* cend() const override { return nullptr; }
+    using Iterator = List<int, 3>::iterator;
+    using ConstIterator = List<int, 3>::const_iterator;
+    class DummyContainer : public List<int, 3>::container_type { Container& operator=(const Container&) override { return *this; }
+    Iterator begin() override { return {}; }
+    ConstIterator begin() const override { return {}; }
+    ConstIterator cbegin() const override { return {}; }
+    Iterator end() override { return {}; }
+    ConstIterator end() const override { return {}; }
+    ConstIterator cend() const override { return {}; }
     bool operator==(const Container&) const override { return false; }
     bool operator!=(const Container&) const override { return true; }
     size_t size() const override { return 0; }
@@ -183,10 +196,10 @@ TEST(ListTest, ConstFrontBackAccess) {
 
 TEST(ListTest, EdgeIterators) {
     List<int, 3> list;
-    EXPECT_EQ(list.end(), nullptr);
-    EXPECT_EQ(list.cend(), nullptr);
-    EXPECT_EQ(list.rend(), nullptr);
-    EXPECT_EQ(list.crend(), nullptr);
+    EXPECT_TRUE(list.begin() == list.end());
+    EXPECT_TRUE(list.cbegin() == list.cend());
+    EXPECT_TRUE(list.rbegin() == list.rend());
+    EXPECT_TRUE(list.crbegin() == list.crend());
 
     list.push_back(42);
     EXPECT_EQ(*list.rbegin(), 42);
@@ -197,7 +210,7 @@ TEST(ListTest, PopBackEdgeCases) {
     List<int, 3> list = {1};
     list.pop_back();
     EXPECT_TRUE(list.empty());
-    EXPECT_EQ(list.begin(), nullptr);
+    EXPECT_TRUE(list.begin() == list.end());
 }
 
 TEST(ListTest, PushFrontToEmpty) {
@@ -210,17 +223,17 @@ TEST(ListTest, PushFrontToEmpty) {
 
 TEST(ListTest, InsertEdgeCases) {
     List<int, 5> list;
-    list.insert(nullptr, 100);
+    list.insert(list.end(), 100);
     EXPECT_EQ(list.back(), 100);
 
-    int* pos = list.begin();
+    auto pos = list.begin();
     list.insert(pos, 200);
     EXPECT_EQ(list.front(), 200);
 }
 
 TEST(ListTest, EraseLastElement) {
     List<int, 3> list = {1, 2};
-    int* last = list.next(list.begin());
+    auto last = std::next(list.begin());
     list.erase(last);
     EXPECT_EQ(list.size(), 1);
     EXPECT_EQ(list.back(), 1);
@@ -231,20 +244,22 @@ namespace my_container {
 TEST(ListTest, ContainerAssignmentOperator) {
     List<int, 3> list;
     list.push_back(1);
-    const Container<int, 3>& base_ref = list;
+    const List<int, 3>::container_type& base_ref = list;
     list = base_ref;
     EXPECT_EQ(list.size(), 1);
     EXPECT_EQ(list.front(), 1);
 
-    class DummyContainer : public Container<int, 3> {
+    using Iterator = List<int, 3>::iterator;
+    using ConstIterator = List<int, 3>::const_iterator;
+    class DummyContainer : public List<int, 3>::container_type {
     public:
         Container& operator=(const Container&) override { return *this; }
-        int* begin() override { return nullptr; }
-        const int* begin() const override { return nullptr; }
-        const int* cbegin() const override { return nullptr; }
-        int* end() override { return nullptr; }
-        const int* end() const override { return nullptr; }
-        const int* cend() const override { return nullptr; }
+        Iterator begin() override { return {}; }
+        ConstIterator begin() const override { return {}; }
+        ConstIterator cbegin() const override { return {}; }
+        Iterator end() override { return {}; }
+        ConstIterator end() const override { return {}; }
+        ConstIterator cend() const override { return {}; }
         bool operator==(const Container&) const override { return false; }
         bool operator!=(const Container&) const override { return true; }
         size_t size() const override { return 0; }
@@ -267,7 +282,7 @@ TEST(ListTest, ContainerAssignmentOperator) {
 TEST(ListTest, EraseOperations) {
     List<int, 5> list = {1, 2, 3, 4};
 
-    auto pos = list.next(list.next(list.begin()));
+    auto pos = std::next(list.begin(), 2);
     list.erase(pos);
     EXPECT_EQ(list.size(), 3);
     EXPECT_EQ(list.back(), 4);
@@ -277,37 +292,33 @@ TEST(ListTest, EraseOperations) {
     EXPECT_EQ(list.front(), 2);
 
     pos = list.begin();
-    while (list.next(pos) != nullptr) {
-        pos = list.next(pos);
+    while (std::next(pos) != list.end()) {
+        ++pos;
     }
     list.erase(pos);
     if (!list.empty()) {
         EXPECT_EQ(list.back(), 2);
     } else {
-        EXPECT_EQ(list.rbegin(), nullptr); 
+        EXPECT_TRUE(list.rbegin() == list.rend());
     }
 
-    EXPECT_EQ(list.erase(nullptr), nullptr);
+    EXPECT_TRUE(list.erase(list.end()) == list.end());
 }
 
 TEST(ListTest, EraseLastElementFromMultiple) {
     List<int, 3> list = {1, 2, 3};
-    auto pos = list.begin();
-    while (list.next(pos) != nullptr) {
-        pos = list.next(pos);
-    }
+    auto pos = std::prev(list.end());
     list.erase(pos);
     EXPECT_EQ(list.back(), 2);
 }
 
 TEST(ListTest, ReverseIterators) {
     List<int, 3> empty_list;
-    EXPECT_EQ(empty_list.rbegin(), nullptr);
-    EXPECT_EQ(empty_list.rend(), nullptr);
+    EXPECT_TRUE(empty_list.rbegin() == empty_list.rend());
 
     List<int, 3> list = {10, 20, 30};
     int sum = 0;
-    for (auto it = list.rbegin(); it != list.rend(); it = list.prev(it)) {
+    for (auto it = list.rbegin(); it != list.rend(); ++it) {
         sum += *it;
     }
     EXPECT_EQ(sum, 60);
@@ -319,7 +330,7 @@ TEST(ListTest, ContainerAssignmentOperator_ZeroCoverage) {
     List<int, 3> list1 = {1, 2};
     List<int, 3> list2 = {3, 4, 5};
 
-    Container<int, 3>* base_ptr = &list2;
+    List<int, 3>::container_type* base_ptr = &list2;
     list1 = *base_ptr;
 
     EXPECT_EQ(list1.size(), 3);
@@ -340,6 +351,750 @@ TEST(ListTest, ContainerAssignmentOperator_ZeroCoverage) {
 
 }
 
+TEST(ListAllocatorTest, PoolAllocator) {
+    my_container::Pool pool;
+    using PoolList = my_container::List<int, 0, my_container::PoolAllocator<int>>;
+    PoolList list{my_container::PoolAllocator<int>(pool)};
+    for (int i = 0; i < 100; ++i) list.push_back(i);
+    for (int i = 0; i < 50; ++i) list.pop_front();
+    for (int i = 0; i < 50; ++i) list.push_front(i);
+    EXPECT_EQ(list.size(), 100);
+    EXPECT_EQ(list.front(), 49);
+    EXPECT_EQ(list.back(), 99);
+
+    PoolList copy(list);
+    EXPECT_TRUE(copy == list);
+    EXPECT_EQ(&copy.get_allocator().resource(), &pool);
+}
+
+TEST(ListAllocatorTest, ArenaBuildAndDiscard) {
+    my_container::Arena arena;
+    using ArenaList = my_container::List<std::string, 0, my_container::ArenaAllocator<std::string>>;
+    for (int round = 0; round < 3; ++round) {
+        {
+            ArenaList list({"a", "b"}, my_container::ArenaAllocator<std::string>(arena));
+            list.push_back("c");
+            EXPECT_EQ(list.size(), 3);
+        }
+        arena.reset();
+    }
+}
+
+namespace {
+
+struct AllocCounter {
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+};
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    AllocCounter* counter;
+
+    explicit CountingAllocator(AllocCounter& c) : counter(&c) {}
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) : counter(other.counter) {}
+
+    T* allocate(size_t n) {
+        ++counter->allocations;
+        counter->live_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        counter->live_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>& other) const { return counter == other.counter; }
+};
+
+using CountedList = my_container::List<std::string, 0, CountingAllocator<std::string>>;
+
+}
+
+TEST(ListSlabTest, NodesComeFromSlabs) {
+    AllocCounter counter;
+    {
+        CountedList list{CountingAllocator<std::string>(counter)};
+        for (int i = 0; i < 10000; ++i) list.push_back(std::to_string(i));
+        EXPECT_LT(counter.allocations, 100);
+        EXPECT_EQ(list.back(), "9999");
+    }
+    EXPECT_EQ(counter.live_bytes, 0);
+}
+
+TEST(ListSlabTest, ClearReturnsWholeSlabs) {
+    AllocCounter counter;
+    {
+        CountedList list{CountingAllocator<std::string>(counter)};
+        for (int i = 0; i < 10000; ++i) list.push_back(std::to_string(i));
+        size_t filled = counter.live_bytes;
+
+        list.clear();
+        EXPECT_TRUE(list.empty());
+        EXPECT_LT(counter.live_bytes, filled / 10);
+
+        size_t allocations = counter.allocations;
+        for (int i = 0; i < 100; ++i) list.push_front("again");
+        EXPECT_EQ(counter.allocations, allocations);
+        EXPECT_EQ(list.size(), 100);
+    }
+    EXPECT_EQ(counter.live_bytes, 0);
+}
+
+TEST(ListSlabTest, EmptySlabsReleasedOneNodeAtATime) {
+    AllocCounter counter;
+    {
+        CountedList list{CountingAllocator<std::string>(counter)};
+        for (int i = 0; i < 10000; ++i) list.push_back(std::to_string(i));
+        size_t filled = counter.live_bytes;
+
+        for (auto it = list.begin(); it != list.end();) {
+            it = list.erase(it);
+            if (it != list.end()) ++it;
+        }
+        EXPECT_EQ(list.size(), 5000);
+        EXPECT_EQ(list.front(), "1");
+
+        while (list.size() > 1) list.pop_front();
+        EXPECT_LT(counter.live_bytes, filled / 10);
+        EXPECT_EQ(list.front(), "9999");
+    }
+    EXPECT_EQ(counter.live_bytes, 0);
+}
+
+TEST(ListSlabTest, MoveAndSwapCarryPool) {
+    AllocCounter counter;
+    {
+        CountingAllocator<std::string> alloc(counter);
+        CountedList a(alloc);
+        CountedList b(alloc);
+        for (int i = 0; i < 1000; ++i) a.push_back(std::to_string(i));
+        b.push_back("b");
+
+        a.swap(b);
+        EXPECT_EQ(a.size(), 1);
+        EXPECT_EQ(b.back(), "999");
+
+        CountedList c(std::move(b));
+        b = std::move(a);
+        EXPECT_EQ(b.front(), "b");
+        c.pop_back();
+        EXPECT_EQ(c.back(), "998");
+
+        CountedList d(c);
+        c = b;
+        EXPECT_EQ(c.size(), 1);
+        EXPECT_EQ(d.size(), 999);
+    }
+    EXPECT_EQ(counter.live_bytes, 0);
+}
+
+using my_container::List;
+using test_utils::to_vector;
+
+TEST(ListIteratorTest, ModelsBidirectionalIterator) {
+    static_assert(std::bidirectional_iterator<List<int>::iterator>);
+    static_assert(std::bidirectional_iterator<List<int>::const_iterator>);
+    static_assert(std::bidirectional_iterator<List<int>::reverse_iterator>);
+    static_assert(std::ranges::bidirectional_range<List<int>>);
+    static_assert(std::ranges::bidirectional_range<const List<int>>);
+    static_assert(std::is_convertible_v<List<int>::iterator, List<int>::const_iterator>);
+    static_assert(!std::is_convertible_v<List<int>::const_iterator, List<int>::iterator>);
+
+    List<int> list = {1, 2, 3, 4};
+    List<int>::const_iterator it = list.begin();
+    EXPECT_TRUE(it == list.begin());
+    EXPECT_EQ(*std::prev(list.end()), 4);
+    EXPECT_EQ(std::distance(list.begin(), list.end()), 4);
+
+    auto last = list.end();
+    --last;
+    EXPECT_EQ(*last--, 4);
+    EXPECT_EQ(*last, 3);
+}
+
+TEST(ListIteratorTest, RangeForAndAlgorithms) {
+    List<std::string> list = {"a", "bb", "ccc"};
+    std::string joined;
+    for (const auto& item : list) joined += item;
+    EXPECT_EQ(joined, "abbccc");
+
+    auto found = std::find(list.begin(), list.end(), "bb");
+    ASSERT_TRUE(found != list.end());
+    EXPECT_EQ(found->size(), 2);
+    *found = "BB";
+    EXPECT_EQ(*std::next(list.begin()), "BB");
+
+    size_t total = 0;
+    std::for_each(list.cbegin(), list.cend(), [&](const std::string& item) { total += item.size(); });
+    EXPECT_EQ(total, 6);
+
+    std::string reversed;
+    for (auto rit = list.crbegin(); rit != list.crend(); ++rit) reversed += *rit;
+    EXPECT_EQ(reversed, "cccBBa");
+}
+
+TEST(ListIteratorTest, RangePipelines) {
+    List<int> list = {1, 2, 3, 4, 5, 6};
+    int sum = 0;
+    for (int x : list | std::views::filter([](int v) { return v % 2 == 0; }) | std::views::transform([](int v) { return v * 10; })) {
+        sum += x;
+    }
+    EXPECT_EQ(sum, 120);
+
+    auto found = std::ranges::find(list, 4);
+    list.erase(found);
+    EXPECT_EQ(list.size(), 5);
+    EXPECT_TRUE(std::ranges::equal(list | std::views::reverse, std::vector<int>{6, 5, 3, 2, 1}));
+}
+
+TEST(ListIteratorTest, IterationThroughContainerInterface) {
+    List<int> list = {1, 2, 3};
+    List<int>::container_type& base = list;
+    int sum = 0;
+    for (int x : base) sum += x;
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(*std::prev(base.end()), 3);
+}
+
+namespace {
+
+struct CopyCounted {
+    static inline int copies = 0;
+    int key;
+    int order;
+
+    CopyCounted(int k = 0, int o = 0) : key(k), order(o) {}
+    CopyCounted(const CopyCounted& other) : key(other.key), order(other.order) { ++copies; }
+    CopyCounted& operator=(const CopyCounted& other) {
+        key = other.key;
+        order = other.order;
+        ++copies;
+        return *this;
+    }
+    bool operator==(const CopyCounted& other) const { return key == other.key && order == other.order; }
+    bool operator<(const CopyCounted& other) const { return key < other.key; }
+};
+
+}
+
+TEST(ListSpliceTest, WholeListKeepsNodes) {
+    List<std::string> a = {"a", "d"};
+    List<std::string> b = {"b", "c"};
+    const std::string* b_first = &b.front();
+
+    a.splice(std::next(a.begin()), b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_TRUE(b.begin() == b.end());
+    EXPECT_EQ(a.size(), 4);
+    EXPECT_EQ(to_vector(a), (std::vector<std::string>{"a", "b", "c", "d"}));
+    EXPECT_EQ(&*std::next(a.begin()), b_first);
+
+    b.push_back("e");
+    a.splice(a.end(), std::move(b));
+    EXPECT_EQ(a.back(), "e");
+    EXPECT_EQ(*std::prev(a.end()), "e");
+}
+
+TEST(ListSpliceTest, SingleElementAndRange) {
+    List<int> a = {1, 2, 3};
+    List<int> b = {10, 20, 30, 40};
+
+    a.splice(a.begin(), b, std::next(b.begin()));
+    EXPECT_EQ(to_vector(a), (std::vector<int>{20, 1, 2, 3}));
+    EXPECT_EQ(to_vector(b), (std::vector<int>{10, 30, 40}));
+
+    a.splice(a.end(), b, b.begin(), b.end());
+    EXPECT_EQ(to_vector(a), (std::vector<int>{20, 1, 2, 3, 10, 30, 40}));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.size(), 7);
+
+    a.splice(a.end(), a, a.begin());
+    EXPECT_EQ(to_vector(a), (std::vector<int>{1, 2, 3, 10, 30, 40, 20}));
+    a.splice(a.begin(), a, std::next(a.begin(), 3), std::next(a.begin(), 5));
+    EXPECT_EQ(to_vector(a), (std::vector<int>{10, 30, 1, 2, 3, 40, 20}));
+    a.splice(a.begin(), a, a.begin());
+    a.splice(std::next(a.begin()), a, a.begin());
+    EXPECT_EQ(to_vector(a), (std::vector<int>{10, 30, 1, 2, 3, 40, 20}));
+    EXPECT_EQ(a.size(), 7);
+    EXPECT_EQ(a.back(), 20);
+}
+
+TEST(ListSpliceTest, NodesOutliveTheirPool) {
+    AllocCounter counter;
+    CountingAllocator<std::string> alloc(counter);
+    {
+        CountedList kept(alloc);
+        kept.push_back("kept");
+        {
+            CountedList donor(alloc);
+            for (int i = 0; i < 1000; ++i) donor.push_back(std::to_string(i));
+            kept.splice(kept.end(), donor, std::next(donor.begin(), 10), std::next(donor.begin(), 20));
+            kept.splice(kept.begin(), donor, std::prev(donor.end()));
+        }
+        EXPECT_EQ(kept.size(), 12);
+        EXPECT_EQ(kept.front(), "999");
+        EXPECT_EQ(kept.back(), "19");
+        kept.pop_back();
+        kept.clear();
+        kept.push_back("again");
+        EXPECT_EQ(kept.front(), "again");
+    }
+    EXPECT_EQ(counter.live_bytes, 0);
+}
+
+TEST(ListSpliceTest, MergeIsStable) {
+    List<CopyCounted> a = {{1, 0}, {3, 0}, {5, 0}};
+    List<CopyCounted> b = {{1, 1}, {2, 1}, {5, 1}, {7, 1}};
+    CopyCounted::copies = 0;
+    a.merge(b);
+    EXPECT_EQ(CopyCounted::copies, 0);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(to_vector(a), (std::vector<CopyCounted>{{1, 0}, {1, 1}, {2, 1}, {3, 0}, {5, 0}, {5, 1}, {7, 1}}));
+
+    List<int> desc = {9, 5, 1};
+    desc.merge(List<int>{8, 4}, std::greater<>{});
+    EXPECT_EQ(to_vector(desc), (std::vector<int>{9, 8, 5, 4, 1}));
+}
+
+TEST(ListSpliceTest, SortRelinksAndIsStable) {
+    List<CopyCounted> list;
+    std::vector<CopyCounted> expected;
+    unsigned seed = 12345;
+    for (int i = 0; i < 1000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        int key = static_cast<int>((seed >> 16) % 50);
+        list.push_back(CopyCounted(key, i));
+        expected.emplace_back(key, i);
+    }
+    std::stable_sort(expected.begin(), expected.end());
+    const CopyCounted* smallest = &*std::min_element(list.begin(), list.end(), [](auto& x, auto& y) {
+        return x.key < y.key || (x.key == y.key && x.order < y.order);
+    });
+
+    CopyCounted::copies = 0;
+    list.sort();
+    EXPECT_EQ(CopyCounted::copies, 0);
+    EXPECT_EQ(to_vector(list), expected);
+    EXPECT_EQ(&list.front(), smallest);
+    EXPECT_EQ(list.size(), 1000);
+    EXPECT_TRUE(std::is_sorted(list.rbegin(), list.rend(), [](auto& x, auto& y) { return y < x; }));
+
+    List<int> ints = {3, 1, 2};
+    ints.sort(std::greater<>{});
+    EXPECT_EQ(to_vector(ints), (std::vector<int>{3, 2, 1}));
+}
+
+TEST(ListSpliceTest, SortKeepsNodesWhenComparatorThrows) {
+    List<int> list;
+    for (int i = 0; i < 100; ++i) list.push_back((i * 37) % 100);
+    int calls = 0;
+    auto throwing = [&calls](int x, int y) {
+        if (++calls == 300) throw std::runtime_error("compare");
+        return x < y;
+    };
+    EXPECT_THROW(list.sort(throwing), std::runtime_error);
+    EXPECT_EQ(list.size(), 100);
+    EXPECT_EQ(std::distance(list.begin(), list.end()), 100);
+    EXPECT_EQ(std::distance(list.rbegin(), list.rend()), 100);
+    std::vector<int> values = to_vector(list);
+    std::sort(values.begin(), values.end());
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(values[i], i);
+}
+
+TEST(ListSpliceTest, UniqueAndReverse) {
+    List<int> list = {1, 1, 2, 3, 3, 3, 1, 4, 4};
+    EXPECT_EQ(list.unique(), 4);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{1, 2, 3, 1, 4}));
+    EXPECT_EQ(list.unique([](int a, int b) { return b == a + 1; }), 1);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{1, 3, 1, 4}));
+
+    list.push_back(7);
+    list.reverse();
+    EXPECT_EQ(to_vector(list), (std::vector<int>{7, 4, 1, 3, 1}));
+    EXPECT_EQ(list.front(), 7);
+    EXPECT_EQ(*std::prev(list.end()), 1);
+
+    List<int> empty;
+    EXPECT_EQ(empty.unique(), 0);
+    empty.reverse();
+    empty.sort();
+    EXPECT_TRUE(empty.empty());
+}
+
+namespace {
+
+// Считает копирования и перемещения отдельно
+struct Tracked {
+    static inline int copies = 0;
+    static inline int moves = 0;
+    std::string name;
+    int id;
+
+    Tracked(std::string n, int i) : name(std::move(n)), id(i) {}
+    Tracked(const Tracked& other) : name(other.name), id(other.id) { ++copies; }
+    Tracked(Tracked&& other) noexcept : name(std::move(other.name)), id(other.id) { ++moves; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    bool operator==(const Tracked&) const = default;
+
+    static void reset() {
+        copies = 0;
+        moves = 0;
+    }
+};
+
+}
+
+TEST(ListEmplaceTest, EmplaceBuildsInPlace) {
+    List<Tracked> list;
+    Tracked::reset();
+    Tracked& back = list.emplace_back("b", 2);
+    Tracked& front = list.emplace_front("a", 1);
+    auto it = list.emplace(std::next(list.begin()), "mid", 3);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+
+    EXPECT_EQ(&back, &list.back());
+    EXPECT_EQ(&front, &list.front());
+    EXPECT_EQ(it->name, "mid");
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(std::next(list.begin())->id, 3);
+
+    auto last = list.emplace(list.end(), "z", 4);
+    EXPECT_EQ(last->id, 4);
+    EXPECT_EQ(&*last, &list.back());
+}
+
+TEST(ListEmplaceTest, RvaluePushMovesInsteadOfCopying) {
+    List<Tracked> list;
+    Tracked::reset();
+    list.push_back(Tracked("x", 1));
+    list.push_front(Tracked("y", 2));
+    list.insert(list.end(), Tracked("z", 3));
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 3);
+
+    Tracked value("w", 4);
+    list.push_back(value);
+    EXPECT_EQ(Tracked::copies, 1);
+
+    std::string payload(1000, 'p');
+    const char* buffer = payload.data();
+    List<std::string> strings;
+    strings.push_back(std::move(payload));
+    EXPECT_EQ(strings.back().data(), buffer);
+}
+
+TEST(ListEmplaceTest, ThrowingConstructorLeavesListIntact) {
+    struct Fragile {
+        int value;
+        explicit Fragile(int v) : value(v) {
+            if (v < 0) throw std::runtime_error("negative");
+        }
+        bool operator==(const Fragile&) const = default;
+    };
+    List<Fragile> list;
+    list.emplace_back(1);
+    list.emplace_back(2);
+    EXPECT_THROW(list.emplace_back(-1), std::runtime_error);
+    EXPECT_THROW(list.emplace_front(-1), std::runtime_error);
+    EXPECT_THROW(list.emplace(std::next(list.begin()), -1), std::runtime_error);
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_EQ(list.front().value, 1);
+    EXPECT_EQ(list.back().value, 2);
+    EXPECT_EQ(std::distance(list.begin(), list.end()), 2);
+}
+
+namespace {
+
+template <typename L>
+std::vector<const void*> node_addresses(const L& list) {
+    std::vector<const void*> result;
+    for (const auto& value : list) result.push_back(&value);
+    return result;
+}
+
+}
+
+TEST(ListAssignTest, CopyAssignmentReusesNodes) {
+    AllocCounter counter;
+    CountingAllocator<std::string> alloc(counter);
+    CountedList target(alloc);
+    CountedList snapshot(alloc);
+    for (int i = 0; i < 1000; ++i) {
+        target.push_back("old " + std::to_string(i));
+        snapshot.push_back("new " + std::to_string(i));
+    }
+    auto before = node_addresses(target);
+    size_t allocations = counter.allocations;
+
+    target = snapshot;
+    EXPECT_TRUE(target == snapshot);
+    EXPECT_EQ(node_addresses(target), before);
+    EXPECT_EQ(counter.allocations, allocations);
+
+    const CountedList::container_type& base = snapshot;
+    snapshot.front() = "changed";
+    target = base;
+    EXPECT_EQ(target.front(), "changed");
+    EXPECT_EQ(node_addresses(target), before);
+}
+
+TEST(ListAssignTest, OnlyLengthDifferenceIsAllocatedOrFreed) {
+    List<int> target = {1, 2, 3, 4, 5};
+    auto before = node_addresses(target);
+
+    List<int> longer = {10, 20, 30, 40, 50, 60, 70};
+    target = longer;
+    EXPECT_EQ(to_vector(target), to_vector(longer));
+    auto after = node_addresses(target);
+    EXPECT_TRUE(std::equal(before.begin(), before.end(), after.begin()));
+    EXPECT_EQ(*std::prev(target.end()), 70);
+
+    List<int> shorter = {7, 8};
+    target = shorter;
+    EXPECT_EQ(to_vector(target), (std::vector<int>{7, 8}));
+    EXPECT_EQ(node_addresses(target), (std::vector<const void*>{before[0], before[1]}));
+    EXPECT_EQ(target.back(), 8);
+
+    target = List<int>();
+    EXPECT_TRUE(target.empty());
+    EXPECT_TRUE(target.begin() == target.end());
+}
+
+TEST(ListAssignTest, AssignOverloads) {
+    List<std::string> list = {"a", "b", "c"};
+    auto before = node_addresses(list);
+
+    std::vector<std::string> source = {"x", "y", "z"};
+    list.assign(source.begin(), source.end());
+    EXPECT_EQ(to_vector(list), source);
+    EXPECT_EQ(node_addresses(list), before);
+
+    list.assign(5, "q");
+    EXPECT_EQ(to_vector(list), (std::vector<std::string>(5, "q")));
+    list.assign(1, list.back());
+    EXPECT_EQ(to_vector(list), (std::vector<std::string>{"q"}));
+    EXPECT_EQ(node_addresses(list).front(), before.front());
+
+    list.assign({"m", "n"});
+    EXPECT_EQ(to_vector(list), (std::vector<std::string>{"m", "n"}));
+
+    List<int> numbers;
+    numbers.assign(3, 5);
+    EXPECT_EQ(to_vector(numbers), (std::vector<int>{5, 5, 5}));
+}
+
+namespace {
+
+// Доля соседних узлов, лежащих в памяти вплотную друг за другом
+template <typename L>
+double sequential_share(const L& list, size_t skip = 0) {
+    auto addresses = node_addresses(list);
+    if (addresses.size() < skip + 2) return 1.0;
+    const char* first = static_cast<const char*>(addresses[skip]);
+    std::ptrdiff_t stride = static_cast<const char*>(addresses[skip + 1]) - first;
+    size_t adjacent = 0;
+    for (size_t i = skip + 1; i < addresses.size(); ++i) {
+        std::ptrdiff_t step = static_cast<const char*>(addresses[i]) - static_cast<const char*>(addresses[i - 1]);
+        if (step == stride) ++adjacent;
+    }
+    return static_cast<double>(adjacent) / static_cast<double>(addresses.size() - skip - 1);
+}
+
+struct CopyBudget {
+    static inline int remaining = -1;
+    int value;
+
+    CopyBudget(int v) : value(v) {}
+    CopyBudget(const CopyBudget& other) : value(other.value) {
+        if (remaining == 0) throw std::runtime_error("copy budget exhausted");
+        if (remaining > 0) --remaining;
+    }
+    CopyBudget& operator=(const CopyBudget&) = default;
+    bool operator==(const CopyBudget&) const = default;
+};
+
+}
+
+TEST(ListBulkTest, RangeConstructionIsSequential) {
+    std::vector<int> source(10000);
+    for (int i = 0; i < 10000; ++i) source[i] = i;
+    List<int> list(source.begin(), source.end());
+    EXPECT_EQ(to_vector(list), source);
+    EXPECT_GT(sequential_share(list), 0.99);
+
+    List<int> copy(list);
+    EXPECT_TRUE(copy == list);
+    EXPECT_GT(sequential_share(copy), 0.99);
+
+    std::istringstream input("1 2 3 4");
+    List<int> parsed(std::istream_iterator<int>(input), std::istream_iterator<int>{});
+    EXPECT_EQ(to_vector(parsed), (std::vector<int>{1, 2, 3, 4}));
+}
+
+TEST(ListBulkTest, BulkAppendSkipsFreedNodes) {
+    List<int> list;
+    for (int i = 0; i < 4000; ++i) list.push_back(i);
+    for (auto it = list.begin(); it != list.end();) {
+        it = list.erase(it);
+        if (it != list.end()) ++it;
+    }
+    ASSERT_EQ(list.size(), 2000);
+
+    std::vector<int> source(3000, 7);
+    list.bulk_push_back(source.begin(), source.end());
+    EXPECT_EQ(list.size(), 5000);
+    EXPECT_GT(sequential_share(list, 2000), 0.99);
+    EXPECT_EQ(list.back(), 7);
+    EXPECT_EQ(*std::prev(list.end(), 3001), 3999);
+}
+
+TEST(ListBulkTest, BulkNodesReleasedOneAtATime) {
+    AllocCounter counter;
+    {
+        std::vector<std::string> source;
+        for (int i = 0; i < 10000; ++i) source.push_back(std::to_string(i));
+        CountedList list(source.begin(), source.end(), CountingAllocator<std::string>(counter));
+        size_t filled = counter.live_bytes;
+
+        for (auto it = list.begin(); it != list.end();) {
+            it = list.erase(it);
+            if (it != list.end()) ++it;
+        }
+        while (list.size() > 1) list.pop_back();
+        EXPECT_LT(counter.live_bytes, filled / 10);
+        EXPECT_EQ(list.front(), "1");
+    }
+    EXPECT_EQ(counter.live_bytes, 0);
+}
+
+TEST(ListBulkTest, ThrowingCopyLeavesListUnchanged) {
+    List<CopyBudget> list = {1, 2, 3};
+    std::vector<CopyBudget> source = {4, 5, 6, 7, 8};
+    CopyBudget::remaining = 3;
+    EXPECT_THROW(list.bulk_push_back(source.begin(), source.end()), std::runtime_error);
+    CopyBudget::remaining = -1;
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(list.back().value, 3);
+    EXPECT_EQ(std::distance(list.begin(), list.end()), 3);
+
+    list.bulk_push_back(source.begin(), source.end());
+    EXPECT_EQ(list.size(), 8);
+    EXPECT_EQ(list.back().value, 8);
+}
+
+TEST(ListIndexTest, IndexedAccess) {
+    List<int> list = {0, 1, 2, 3, 4, 5, 6};
+    for (size_t i = 0; i < list.size(); ++i) EXPECT_EQ(list[i], static_cast<int>(i));
+    for (size_t i = list.size(); i-- > 0;) EXPECT_EQ(list.at(i), static_cast<int>(i));
+    EXPECT_EQ(list[5], 5);
+    EXPECT_EQ(list[1], 1);
+    list[3] = 30;
+    const List<int>& view = list;
+    EXPECT_EQ(view[3], 30);
+    EXPECT_EQ(view.at(6), 6);
+    EXPECT_THROW(list.at(7), std::out_of_range);
+    EXPECT_THROW(view.at(100), std::out_of_range);
+}
+
+TEST(ListIndexTest, ConstAccessFromSeveralThreads) {
+    List<int> list;
+    for (int i = 0; i < 1000; ++i) list.push_back(i);
+    const List<int>& view = list;
+
+    std::vector<long long> sums(4, 0);
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < sums.size(); ++t) {
+        readers.emplace_back([&view, &sums, t] {
+            for (size_t i = t; i < view.size(); i += 7) sums[t] += view[i];
+        });
+    }
+    for (auto& reader : readers) reader.join();
+
+    for (size_t t = 0; t < sums.size(); ++t) {
+        long long expected = 0;
+        for (size_t i = t; i < 1000; i += 7) expected += static_cast<long long>(i);
+        EXPECT_EQ(sums[t], expected);
+    }
+}
+
+TEST(ListIndexTest, CursorFollowsMutations) {
+    std::mt19937 gen(23);
+    List<int> list;
+    std::vector<int> model;
+    for (int i = 0; i < 64; ++i) {
+        list.push_back(i);
+        model.push_back(i);
+    }
+    for (int step = 0; step < 20000; ++step) {
+        size_t pos = gen() % (model.size() + 1);
+        auto offset = static_cast<std::ptrdiff_t>(pos);
+        switch (gen() % 9) {
+            case 0:
+                list.push_back(step);
+                model.push_back(step);
+                break;
+            case 1:
+                list.push_front(step);
+                model.insert(model.begin(), step);
+                break;
+            case 2:
+                list.insert(std::next(list.begin(), offset), step);
+                model.insert(model.begin() + offset, step);
+                break;
+            case 3:
+                list.pop_back();
+                if (!model.empty()) model.pop_back();
+                break;
+            case 4:
+                list.pop_front();
+                if (!model.empty()) model.erase(model.begin());
+                break;
+            case 5:
+                if (pos < model.size()) {
+                    list.erase(std::next(list.begin(), offset));
+                    model.erase(model.begin() + offset);
+                }
+                break;
+            case 6:
+                if (gen() % 50 == 0) {
+                    list.reverse();
+                    std::reverse(model.begin(), model.end());
+                }
+                break;
+            default:
+                if (pos < model.size()) {
+                    ASSERT_EQ(list[pos], model[pos]) << step;
+                }
+                break;
+        }
+        ASSERT_EQ(list.size(), model.size());
+    }
+    for (size_t i = 0; i < model.size(); ++i) ASSERT_EQ(list[i], model[i]);
+
+    List<int> other = {100, 101};
+    EXPECT_EQ(other[1], 101);
+    EXPECT_EQ(list[0], model[0]);
+    list.swap(other);
+    EXPECT_EQ(list[1], 101);
+    EXPECT_EQ(other[0], model[0]);
+    list.splice(list.begin(), other, std::next(other.begin()));
+    EXPECT_EQ(list[1], 100);
+    EXPECT_EQ(other[0], model[0]);
+    list.sort(std::greater<>());
+    EXPECT_EQ(list[0], std::max(model[1], 101));
+    EXPECT_EQ(list[2], std::min(model[1], 100));
+    list.clear();
+    list.push_back(7);
+    EXPECT_EQ(list[0], 7);
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
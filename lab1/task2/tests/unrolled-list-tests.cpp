@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include "../include/unrolled-list.hpp"
+#include "../../task1/include/allocators.hpp"
+#include "../../task1/tests/test-utils.hpp"
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace my_container;
+using test_utils::to_vector;
+
+TEST(UnrolledListTest, NodeFitsCacheLines) {
+    using Node = detail::UnrolledNode<int>;
+    EXPECT_EQ(sizeof(Node) % detail::cache_line_size, 0);
+    EXPECT_LE(sizeof(Node), 2 * detail::cache_line_size);
+    EXPECT_GT(UnrolledList<int>::node_capacity, 16);
+    EXPECT_GE(UnrolledList<std::string>::node_capacity, 4);
+}
+
+TEST(UnrolledListTest, BasicOperations) {
+    UnrolledList<int, 5> list = {1, 2, 3};
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 3);
+
+    list.push_front(0);
+    list.push_back(4);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(to_vector(list), (std::vector<int>{1, 2, 3}));
+
+    UnrolledList<int, 5> copy(list);
+    EXPECT_TRUE(copy == list);
+    copy.push_back(7);
+    EXPECT_TRUE(copy != list);
+    EXPECT_TRUE(list < copy);
+
+    UnrolledList<int, 5> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 4);
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_THROW(moved.front(), std::out_of_range);
+    EXPECT_THROW(moved.back(), std::out_of_range);
+}
+
+TEST(UnrolledListTest, EndsFillWholeNodes) {
+    const size_t k = UnrolledList<int>::node_capacity;
+    UnrolledList<int> list;
+    for (size_t i = 0; i < 4 * k; ++i) list.push_back(static_cast<int>(i));
+    EXPECT_EQ(list.node_count(), 4);
+    for (size_t i = 0; i < 4 * k; ++i) list.push_front(-1 - static_cast<int>(i));
+    EXPECT_EQ(list.node_count(), 8);
+
+    for (size_t i = 0; i < 4 * k; ++i) list.pop_back();
+    EXPECT_EQ(list.node_count(), 4);
+    EXPECT_EQ(list.back(), -1);
+    while (!list.empty()) list.pop_front();
+    EXPECT_EQ(list.node_count(), 0);
+}
+
+TEST(UnrolledListTest, InsertSplitsAndEraseMerges) {
+    const size_t k = UnrolledList<int>::node_capacity;
+    UnrolledList<int> list;
+    std::vector<int> expected;
+    for (size_t i = 0; i < k; ++i) {
+        list.push_back(static_cast<int>(i));
+        expected.push_back(static_cast<int>(i));
+    }
+    ASSERT_EQ(list.node_count(), 1);
+
+    auto it = list.insert(std::next(list.begin(), 3), 100);
+    expected.insert(expected.begin() + 3, 100);
+    EXPECT_EQ(*it, 100);
+    EXPECT_EQ(list.node_count(), 2);
+    EXPECT_EQ(to_vector(list), expected);
+
+    while (list.size() > 2) {
+        it = list.erase(std::next(list.begin()));
+        expected.erase(expected.begin() + 1);
+        ASSERT_EQ(*it, expected[1]);
+    }
+    EXPECT_EQ(list.node_count(), 1);
+    EXPECT_EQ(to_vector(list), expected);
+
+    it = list.erase(std::prev(list.end()));
+    EXPECT_TRUE(it == list.end());
+    EXPECT_EQ(list.erase(list.end()), list.end());
+}
+
+TEST(UnrolledListTest, MatchesStdListUnderRandomEdits) {
+    std::mt19937 gen(42);
+    UnrolledList<std::string> list;
+    std::list<std::string> model;
+    for (int step = 0; step < 20000; ++step) {
+        std::string value = std::to_string(step);
+        size_t pos = model.empty() ? 0 : gen() % (model.size() + 1);
+        switch (gen() % 6) {
+            case 0:
+                list.push_back(value);
+                model.push_back(value);
+                break;
+            case 1:
+                list.push_front(value);
+                model.push_front(value);
+                break;
+            case 2:
+                if (!model.empty()) {
+                    list.pop_back();
+                    model.pop_back();
+                }
+                break;
+            case 3:
+                if (!model.empty()) {
+                    list.pop_front();
+                    model.pop_front();
+                }
+                break;
+            case 4: {
+                auto it = list.insert(std::next(list.cbegin(), pos), value);
+                model.insert(std::next(model.cbegin(), pos), value);
+                ASSERT_EQ(*it, value);
+                break;
+            }
+            default:
+                if (pos < model.size()) {
+                    auto it = list.erase(std::next(list.cbegin(), pos));
+                    auto expected = model.erase(std::next(model.cbegin(), pos));
+                    ASSERT_EQ(it == list.end(), expected == model.end());
+                    if (expected != model.end()) {
+                        ASSERT_EQ(*it, *expected);
+                    }
+                }
+                break;
+        }
+        ASSERT_EQ(list.size(), model.size());
+    }
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), model.begin(), model.end()));
+    EXPECT_TRUE(std::equal(list.rbegin(), list.rend(), model.rbegin(), model.rend()));
+    EXPECT_LE(list.node_count() * UnrolledList<std::string>::node_capacity, 4 * list.size() + 64);
+}
+
+TEST(UnrolledListTest, InsertAliasedValue) {
+    UnrolledList<std::string> list;
+    for (size_t i = 0; i < UnrolledList<std::string>::node_capacity; ++i) list.push_back(std::string(30, static_cast<char>('a' + i)));
+    std::string expected = list.back();
+    list.insert(list.begin(), list.back());
+    EXPECT_EQ(list.front(), expected);
+}
+
+TEST(UnrolledListTest, IteratorsAndContainerInterface) {
+    static_assert(std::bidirectional_iterator<UnrolledList<int>::iterator>);
+    static_assert(std::bidirectional_iterator<UnrolledList<int>::const_iterator>);
+
+    UnrolledList<int> list;
+    for (int i = 0; i < 1000; ++i) list.push_back(i);
+    const UnrolledList<int>::container_type& base = list;
+    int expected = 0;
+    for (auto it = base.begin(); it != base.end(); ++it) EXPECT_EQ(*it, expected++);
+    EXPECT_EQ(*std::prev(list.end()), 999);
+    EXPECT_EQ(*list.rbegin(), 999);
+
+    UnrolledList<int> other;
+    other = base;
+    EXPECT_TRUE(other == list);
+}
+
+TEST(UnrolledListTest, ArenaAllocator) {
+    Arena arena;
+    UnrolledList<int, 0, ArenaAllocator<int>> list({1, 2, 3}, ArenaAllocator<int>(arena));
+    for (int i = 4; i < 200; ++i) list.push_back(i);
+    UnrolledList<int, 0, ArenaAllocator<int>> copy(list);
+    EXPECT_TRUE(copy == list);
+    EXPECT_EQ(&copy.get_allocator().resource(), &arena);
+}
+
+TEST(UnrolledListTest, EmplaceAndRvaluePush) {
+    UnrolledList<std::string> list;
+    std::string payload(1000, 'p');
+    const char* buffer = payload.data();
+    list.push_front(std::move(payload));
+    EXPECT_EQ(list.front().data(), buffer);
+
+    EXPECT_EQ(list.emplace_back(3, 'b'), "bbb");
+    EXPECT_EQ(list.emplace_front(2, 'a'), "aa");
+    auto it = list.emplace(std::next(list.begin()), "mid");
+    EXPECT_EQ(*it, "mid");
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_EQ(list.back(), "bbb");
+}
@@ -0,0 +1,110 @@
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <iterator>
+#include <string>
+#include "../include/deque.hpp"
+#include "../../task2/include/double-linked-list.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename F>
+double measure(size_t rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+// Прежний Deque наследовал List и искал элемент по номеру проходом от головы
+template <typename T>
+const T& list_index(const List<T>& list, size_t pos) {
+    return *std::next(list.begin(), static_cast<std::ptrdiff_t>(pos));
+}
+
+template <typename D>
+size_t indexed_sum(const D& dq) {
+    size_t sum = 0;
+    for (size_t i = 0; i < dq.size(); ++i) sum += static_cast<size_t>(dq[i]);
+    return sum;
+}
+
+template <typename D>
+void fill_both_ends(D& dq, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 2) {
+            dq.push_back(static_cast<int>(i));
+        } else {
+            dq.push_front(static_cast<int>(i));
+        }
+    }
+}
+
+template <typename D>
+void row(const char* name, size_t count, bool indexed) {
+    size_t rounds = std::max<size_t>(1, 4'000'000 / count);
+    volatile size_t sink = 0;
+
+    double push = measure(rounds, [&] {
+        D dq;
+        fill_both_ends(dq, count);
+        sink = sink + dq.size();
+    });
+
+    D dq;
+    fill_both_ends(dq, count);
+    double pop = measure(rounds, [&] {
+        D copy = dq;
+        while (!copy.empty()) {
+            copy.pop_front();
+            if (!copy.empty()) copy.pop_back();
+        }
+        sink = sink + copy.size();
+    });
+
+    // Очередь: пишем в конец, читаем с начала, в деке всё время около 1000 элементов
+    double queue = measure(rounds, [&] {
+        D q;
+        for (size_t i = 0; i < count; ++i) {
+            q.push_back(static_cast<int>(i));
+            if (i >= 1000) q.pop_front();
+        }
+        sink = sink + q.size();
+    });
+
+    double scan = -1;
+    if (indexed) {
+        scan = measure(rounds, [&] {
+            if constexpr (std::is_same_v<D, List<int>>) {
+                size_t sum = 0;
+                for (size_t i = 0; i < dq.size(); ++i) sum += static_cast<size_t>(list_index(dq, i));
+                sink = sink + sum;
+            } else {
+                sink = sink + indexed_sum(dq);
+            }
+        });
+    }
+
+    std::printf("%-18s %9zu %10.3f %10.3f %10.3f ", name, count, push, pop, queue);
+    if (scan < 0) {
+        std::printf("%12s\n", "-");
+    } else {
+        std::printf("%12.3f\n", scan);
+    }
+}
+
+}  // namespace
+
+int main() {
+    std::printf("ms per run; push: alternating push_front/push_back; pop: copy, then pop from both ends;\n"
+                "queue: push_back + pop_front with ~1000 live elements; scan: for (i) sum += dq[i]\n");
+    std::printf("elements per block: int %zu\n", Deque<int>::elements_per_block);
+    std::printf("%-18s %9s %10s %10s %10s %12s\n", "container", "size", "push", "copy+pop", "queue", "index scan");
+    for (size_t count : {1'000, 10'000, 100'000, 1'000'000}) {
+        row<Deque<int>>("Deque<int>", count, true);
+        row<std::deque<int>>("std::deque<int>", count, true);
+        row<List<int>>("List<int> (old)", count, count <= 10'000);
+    }
+    return 0;
+}
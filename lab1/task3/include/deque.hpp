@@ -1,50 +1,644 @@
 #pragma once
-#include "../../task2/include/double-linked-list.hpp"
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../../task1/include/container.hpp"
 
 namespace my_container {
 
-template <typename T, size_t N = 0>
-class Deque : public List<T, N> {
-   public:
+namespace detail {
+
+// Карта блоков: blocks[b] — блок из block_size элементов или nullptr, если в нём нет ни одного элемента.
+// Элемент с номером i лежит в ячейке first + i сквозной нумерации всех блоков карты.
+template <typename T>
+struct DequeMap {
+	static constexpr size_t block_size = std::bit_floor(std::max<size_t>(16, 1024 / sizeof(T)));
+	static constexpr size_t block_shift = std::countr_zero(block_size);
+	static constexpr size_t block_mask = block_size - 1;
+
+	T** blocks = nullptr;
+	size_t capacity = 0;
+	size_t first = 0;
+
+	T& slot(size_t index) const noexcept {
+		size_t cell = first + index;
+		return blocks[cell >> block_shift][cell & block_mask];
+	}
+};
+
+}  // namespace detail
+
+template <typename T, size_t N, typename Alloc>
+class Deque;
+
+// Итератор — номер элемента и указатель на карту дека, поэтому он не зависит от переразмещения карты.
+// Вставка и удаление в начале сдвигают номера: итератор остаётся действительным, но указывает на другой элемент.
+// После перемещения или swap самого дека итератор смотрит на то, что теперь лежит в этом объекте.
+template <typename T, bool Const>
+class DequeIterator {
+private:
+	using Map = detail::DequeMap<T>;
+
+	const Map* map_ = nullptr;
+	size_t index_ = 0;
+
+	template <typename, size_t, typename>
+	friend class Deque;
+	friend class DequeIterator<T, !Const>;
+
+	DequeIterator(const Map* map, size_t index) noexcept : map_(map), index_(index) {}
+
+public:
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = T;
+	using difference_type = std::ptrdiff_t;
+	using pointer = std::conditional_t<Const, const T*, T*>;
+	using reference = std::conditional_t<Const, const T&, T&>;
+
+	DequeIterator() = default;
+
+	template <bool OtherConst>
+		requires(Const && !OtherConst)
+	DequeIterator(const DequeIterator<T, OtherConst>& other) noexcept : map_(other.map_), index_(other.index_) {}
+
+	reference operator*() const { return map_->slot(index_); }
+
+	pointer operator->() const { return &map_->slot(index_); }
+
+	reference operator[](difference_type n) const { return *(*this + n); }
+
+	DequeIterator& operator++() {
+		++index_;
+		return *this;
+	}
+
+	DequeIterator operator++(int) {
+		DequeIterator copy = *this;
+		++index_;
+		return copy;
+	}
+
+	DequeIterator& operator--() {
+		--index_;
+		return *this;
+	}
+
+	DequeIterator operator--(int) {
+		DequeIterator copy = *this;
+		--index_;
+		return copy;
+	}
+
+	DequeIterator& operator+=(difference_type n) {
+		index_ = static_cast<size_t>(static_cast<difference_type>(index_) + n);
+		return *this;
+	}
+
+	DequeIterator& operator-=(difference_type n) { return *this += -n; }
+
+	DequeIterator operator+(difference_type n) const {
+		DequeIterator copy = *this;
+		return copy += n;
+	}
+
+	friend DequeIterator operator+(difference_type n, const DequeIterator& it) { return it + n; }
+
+	DequeIterator operator-(difference_type n) const {
+		DequeIterator copy = *this;
+		return copy -= n;
+	}
+
+	template <bool OtherConst>
+	difference_type operator-(const DequeIterator<T, OtherConst>& other) const noexcept {
+		return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+	}
+
+	template <bool OtherConst>
+	bool operator==(const DequeIterator<T, OtherConst>& other) const noexcept {
+		return index_ == other.index_;
+	}
+
+	template <bool OtherConst>
+	std::strong_ordering operator<=>(const DequeIterator<T, OtherConst>& other) const noexcept {
+		return index_ <=> other.index_;
+	}
+};
+
+// Дек из блоков фиксированного размера и карты указателей на них: operator[] — O(1), вставка и удаление с концов —
+// амортизированно O(1). При росте карты переносятся только указатели на блоки, элементы остаются на месте, так что
+// ссылки на них переживают push/pop с обоих концов. Один опустевший блок держится про запас, чтобы очередь,
+// которая пишет в конец и читает с начала, не обращалась к аллокатору.
+template <typename T, size_t N = 0, typename Alloc = std::allocator<T>>
+class Deque : public Container<T, N, DequeIterator<T, false>, DequeIterator<T, true>> {
+private:
+	using Map = detail::DequeMap<T>;
+	using AllocTraits = std::allocator_traits<Alloc>;
+	using MapAlloc = typename AllocTraits::template rebind_alloc<T*>;
+	using MapAllocTraits = std::allocator_traits<MapAlloc>;
+
+	static constexpr size_t block_size = Map::block_size;
+	static constexpr size_t block_shift = Map::block_shift;
+	static constexpr size_t block_mask = Map::block_mask;
+	static constexpr size_t initial_map_capacity = 8;
+
+	Map map;
+	size_t current_size = 0;
+	T* spare_block = nullptr;
+	[[no_unique_address]] Alloc alloc;
+
+	T* take_block() {
+		if (spare_block) return std::exchange(spare_block, nullptr);
+		return AllocTraits::allocate(alloc, block_size);
+	}
+
+	void give_block(T* block) noexcept {
+		if (!spare_block) {
+			spare_block = block;
+		} else {
+			AllocTraits::deallocate(alloc, block, block_size);
+		}
+	}
+
+	void release_block(size_t index) noexcept {
+		give_block(std::exchange(map.blocks[index], nullptr));
+	}
+
+	size_t first_block() const noexcept { return map.first >> block_shift; }
+
+	size_t used_blocks() const noexcept {
+		return current_size ? ((map.first + current_size - 1) >> block_shift) - first_block() + 1 : 0;
+	}
+
+	// Освобождает в карте место ещё под один блок с нужной стороны. Если карта заполнена меньше чем наполовину,
+	// используемые указатели сдвигаются к середине, иначе карта удваивается; элементы при этом не трогаются.
+	void make_room(bool at_front) {
+		size_t used = used_blocks();
+		size_t needed = used + 1;
+		size_t old_first = first_block();
+		size_t new_capacity = map.capacity;
+		if (new_capacity < 2 * needed) new_capacity = std::max({initial_map_capacity, 2 * map.capacity, 2 * needed});
+		size_t new_first = (new_capacity - needed) / 2 + (at_front ? 1 : 0);
+
+		if (new_capacity == map.capacity) {
+			T** blocks = map.blocks;
+			if (new_first < old_first) {
+				std::copy(blocks + old_first, blocks + old_first + used, blocks + new_first);
+			} else {
+				std::copy_backward(blocks + old_first, blocks + old_first + used, blocks + new_first + used);
+			}
+			std::fill(blocks, blocks + new_first, nullptr);
+			std::fill(blocks + new_first + used, blocks + map.capacity, nullptr);
+		} else {
+			MapAlloc map_alloc(alloc);
+			T** blocks = MapAllocTraits::allocate(map_alloc, new_capacity);
+			std::fill_n(blocks, new_capacity, nullptr);
+			if (map.blocks) {
+				std::copy_n(map.blocks + old_first, used, blocks + new_first);
+				MapAllocTraits::deallocate(map_alloc, map.blocks, map.capacity);
+			}
+			map.blocks = blocks;
+			map.capacity = new_capacity;
+		}
+		map.first = new_first * block_size + (map.first & block_mask);
+	}
+
+	void free_storage() noexcept {
+		clear();
+		if (spare_block) AllocTraits::deallocate(alloc, std::exchange(spare_block, nullptr), block_size);
+		if (map.blocks) {
+			MapAlloc map_alloc(alloc);
+			MapAllocTraits::deallocate(map_alloc, map.blocks, map.capacity);
+		}
+		map = Map{};
+	}
+
+	void steal(Deque& other) noexcept {
+		map = std::exchange(other.map, Map{});
+		current_size = std::exchange(other.current_size, 0);
+		spare_block = std::exchange(other.spare_block, nullptr);
+	}
+
+	// Перезаписывает уже существующие элементы; строятся или разрушаются только элементы на разницу в длине
+	template <typename It>
+	void assign_range(It first, It last) {
+		size_t kept = 0;
+		for (; kept < current_size && first != last; ++first, ++kept) map.slot(kept) = *first;
+		while (current_size > kept) pop_back();
+		bulk_push_back(first, last);
+	}
+
+public:
+	using allocator_type = Alloc;
+	using value_type = T;
+	using reference = T&;
+	using const_reference = const T&;
+	using difference_type = std::ptrdiff_t;
+	using size_type = size_t;
+	using iterator = DequeIterator<T, false>;
+	using const_iterator = DequeIterator<T, true>;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	using container_type = Container<T, N, iterator, const_iterator>;
+
+	static constexpr size_t elements_per_block = block_size;
+
 	Deque() = default;
-	Deque(const Deque& other) : List<T, N>(other) {}
-	Deque(Deque&& other) noexcept : List<T, N>(std::move(other)) {}
-	Deque(std::initializer_list<T> init) : List<T, N>(init) {}
+
+	explicit Deque(const Alloc& alloc) : alloc(alloc) {}
+
+	Deque(const Deque& other) : Deque(AllocTraits::select_on_container_copy_construction(other.alloc)) {
+		bulk_push_back(other.begin(), other.end());
+	}
+
+	Deque(Deque&& other) noexcept : alloc(std::move(other.alloc)) {
+		steal(other);
+	}
+
+	Deque(std::initializer_list<T> init, const Alloc& alloc = Alloc()) : Deque(alloc) {
+		bulk_push_back(init.begin(), init.end());
+	}
+
+	template <std::input_iterator InputIt>
+	Deque(InputIt first, InputIt last, const Alloc& alloc = Alloc()) : Deque(alloc) {
+		bulk_push_back(first, last);
+	}
+
+	~Deque() {
+		free_storage();
+	}
 
 	Deque& operator=(const Deque& other) {
-		List<T, N>::operator=(other);
+		if (this != &other) {
+			if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+				if (alloc != other.alloc) free_storage();
+				alloc = other.alloc;
+			}
+			assign_range(other.begin(), other.end());
+		}
 		return *this;
 	}
 
-	Deque& operator=(const Container<T, N>& other) override {
-		List<T, N>::operator=(other);
+	Deque& operator=(const container_type& other) override {
+		if (this == &other) return *this;
+
+		const Deque* other_deque = dynamic_cast<const Deque*>(&other);
+		if (!other_deque) {
+			throw std::invalid_argument("Container type mismatch in assignment");
+		}
+
+		assign_range(other_deque->begin(), other_deque->end());
 		return *this;
 	}
 
-	Deque& operator=(Deque&& other) noexcept {
-		List<T, N>::operator=(std::move(other));
+	Deque& operator=(Deque&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value ||
+	                                         AllocTraits::is_always_equal::value) {
+		if (this != &other) {
+			if constexpr (!AllocTraits::propagate_on_container_move_assignment::value &&
+			              !AllocTraits::is_always_equal::value) {
+				if (alloc != other.alloc) {
+					assign_range(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+					other.clear();
+					return *this;
+				}
+			}
+			free_storage();
+			if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+				alloc = std::move(other.alloc);
+			}
+			steal(other);
+		}
 		return *this;
 	}
 
+	template <std::input_iterator InputIt>
+	void assign(InputIt first, InputIt last) {
+		assign_range(first, last);
+	}
+
+	void assign(size_t count, const T& value) {
+		size_t kept = std::min(count, current_size);
+		for (size_t i = 0; i < kept; ++i) map.slot(i) = value;
+		while (current_size > count) pop_back();
+		while (current_size < count) emplace_back(value);
+	}
+
+	void assign(std::initializer_list<T> init) {
+		assign_range(init.begin(), init.end());
+	}
+
 	T& at(size_t pos) { return const_cast<T&>(static_cast<const Deque*>(this)->at(pos)); }
 
 	const T& at(size_t pos) const {
-		if (pos >= this->size()) throw std::out_of_range("Deque index out of range");
-		return *get_iterator_at(pos);
+		if (pos >= current_size) throw std::out_of_range("Deque index out of range");
+		return map.slot(pos);
+	}
+
+	T& operator[](size_t pos) { return map.slot(pos); }
+
+	const T& operator[](size_t pos) const { return map.slot(pos); }
+
+	T& front() {
+		if (empty()) throw std::out_of_range("Deque is empty");
+		return map.slot(0);
+	}
+
+	const T& front() const {
+		if (empty()) throw std::out_of_range("Deque is empty");
+		return map.slot(0);
 	}
 
-	T& operator[](size_t pos) { return const_cast<T&>(static_cast<const Deque*>(this)->operator[](pos)); }
+	T& back() {
+		if (empty()) throw std::out_of_range("Deque is empty");
+		return map.slot(current_size - 1);
+	}
+
+	const T& back() const {
+		if (empty()) throw std::out_of_range("Deque is empty");
+		return map.slot(current_size - 1);
+	}
 
-	const T& operator[](size_t pos) const { return *get_iterator_at(pos); }
+	iterator begin() override { return iterator(&map, 0); }
+	const_iterator begin() const override { return const_iterator(&map, 0); }
+	const_iterator cbegin() const override { return begin(); }
+	iterator end() override { return iterator(&map, current_size); }
+	const_iterator end() const override { return const_iterator(&map, current_size); }
+	const_iterator cend() const override { return end(); }
+
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator crbegin() const { return rbegin(); }
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+	const_reverse_iterator crend() const { return rend(); }
+
+	allocator_type get_allocator() const { return alloc; }
+
+	bool empty() const override { return current_size == 0; }
+	size_t size() const override { return current_size; }
+	size_t max_size() const override { return current_size; }
+
+	// Блоки возвращаются аллокатору (кроме запасного), карта остаётся
+	void clear() noexcept {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			for (size_t i = 0; i < current_size; ++i) std::destroy_at(&map.slot(i));
+		}
+		size_t first = first_block();
+		size_t last = first + used_blocks();
+		for (size_t b = first; b < last; ++b) release_block(b);
+		current_size = 0;
+	}
+
+	void push_back(const T& value) { emplace_back(value); }
+
+	void push_back(T&& value) { emplace_back(std::move(value)); }
+
+	template <typename... Args>
+	T& emplace_back(Args&&... args) {
+		if (map.first + current_size == map.capacity * block_size) make_room(false);
+		size_t cell = map.first + current_size;
+		T*& block = map.blocks[cell >> block_shift];
+		bool fresh = !block;
+		if (fresh) block = take_block();
+		try {
+			std::construct_at(block + (cell & block_mask), std::forward<Args>(args)...);
+		} catch (...) {
+			if (fresh) release_block(cell >> block_shift);
+			throw;
+		}
+		++current_size;
+		return block[cell & block_mask];
+	}
 
-   private:
-	const T* get_iterator_at(size_t pos) const {
-		if (pos >= this->size()) return nullptr;
-		const T* it = this->begin();
-		for (size_t i = 0; i < pos; ++i) {
-			it = this->next(const_cast<T*>(it));
+	// Если конструктор элемента бросит, дек останется прежним
+	template <std::input_iterator InputIt>
+	void bulk_push_back(InputIt first, InputIt last) {
+		size_t old_size = current_size;
+		try {
+			for (; first != last; ++first) emplace_back(*first);
+		} catch (...) {
+			while (current_size > old_size) pop_back();
+			throw;
 		}
-		return it;
+	}
+
+	void pop_back() {
+		if (empty()) return;
+		size_t cell = map.first + current_size - 1;
+		std::destroy_at(&map.blocks[cell >> block_shift][cell & block_mask]);
+		--current_size;
+		if (current_size == 0 || (cell & block_mask) == 0) release_block(cell >> block_shift);
+	}
+
+	void push_front(const T& value) { emplace_front(value); }
+
+	void push_front(T&& value) { emplace_front(std::move(value)); }
+
+	template <typename... Args>
+	T& emplace_front(Args&&... args) {
+		if (map.first == 0) make_room(true);
+		size_t cell = map.first - 1;
+		T*& block = map.blocks[cell >> block_shift];
+		bool fresh = !block;
+		if (fresh) block = take_block();
+		try {
+			std::construct_at(block + (cell & block_mask), std::forward<Args>(args)...);
+		} catch (...) {
+			if (fresh) release_block(cell >> block_shift);
+			throw;
+		}
+		--map.first;
+		++current_size;
+		return block[cell & block_mask];
+	}
+
+	void pop_front() {
+		if (empty()) return;
+		size_t cell = map.first;
+		std::destroy_at(&map.blocks[cell >> block_shift][cell & block_mask]);
+		++map.first;
+		--current_size;
+		if (current_size == 0 || (map.first & block_mask) == 0) release_block(cell >> block_shift);
+	}
+
+	iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+
+	iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+	// Новые элементы дописываются в конец и поворачиваются на место
+	template <std::input_iterator InputIt>
+	iterator insert(const_iterator pos, InputIt first, InputIt last) {
+		size_t index = pos.index_;
+		size_t old_size = current_size;
+		bulk_push_back(first, last);
+		std::rotate(begin() + index, begin() + old_size, end());
+		return iterator(&map, index);
+	}
+
+	// В середине сдвигается более короткая сторона
+	template <typename... Args>
+	iterator emplace(const_iterator pos, Args&&... args) {
+		size_t index = pos.index_;
+		if (index == 0) {
+			emplace_front(std::forward<Args>(args)...);
+			return begin();
+		}
+		if (index == current_size) {
+			emplace_back(std::forward<Args>(args)...);
+			return iterator(&map, index);
+		}
+		T value(std::forward<Args>(args)...);
+		if (index < current_size / 2) {
+			emplace_front(std::move(map.slot(0)));
+			std::move(begin() + 2, begin() + index + 1, begin() + 1);
+		} else {
+			size_t old_size = current_size;
+			emplace_back(std::move(map.slot(old_size - 1)));
+			std::move_backward(begin() + index, begin() + old_size - 1, begin() + old_size);
+		}
+		map.slot(index) = std::move(value);
+		return iterator(&map, index);
+	}
+
+	iterator erase(const_iterator pos) {
+		if (pos.index_ >= current_size) return end();
+		return erase(pos, pos + 1);
+	}
+
+	iterator erase(const_iterator first, const_iterator last) {
+		size_t index = first.index_;
+		size_t count = static_cast<size_t>(last - first);
+		if (count == 0) return iterator(&map, index);
+		if (index < current_size - index - count) {
+			std::move_backward(begin(), begin() + index, begin() + index + count);
+			for (size_t i = 0; i < count; ++i) pop_front();
+		} else {
+			std::move(begin() + index + count, end(), begin() + index);
+			for (size_t i = 0; i < count; ++i) pop_back();
+		}
+		return iterator(&map, index);
+	}
+
+	void resize(size_t count) {
+		while (current_size > count) pop_back();
+		while (current_size < count) emplace_back();
+	}
+
+	void swap(Deque& other) noexcept {
+		if constexpr (AllocTraits::propagate_on_container_swap::value) {
+			using std::swap;
+			swap(alloc, other.alloc);
+		}
+		std::swap(map, other.map);
+		std::swap(current_size, other.current_size);
+		std::swap(spare_block, other.spare_block);
+	}
+
+	// В отличие от List, элементы переносятся перемещением, а не перевязкой: O(размера переносимого диапазона
+	// плюс сдвига). Внутри одного дека — поворот; pos не должен лежать внутри [first, last).
+	void splice(const_iterator pos, Deque& other, const_iterator first, const_iterator last) {
+		if (first == last) return;
+		if (&other == this) {
+			if (pos < first) {
+				std::rotate(begin() + pos.index_, begin() + first.index_, begin() + last.index_);
+			} else if (pos > last) {
+				std::rotate(begin() + first.index_, begin() + last.index_, begin() + pos.index_);
+			}
+			return;
+		}
+		iterator from(&other.map, first.index_);
+		iterator to(&other.map, last.index_);
+		insert(pos, std::make_move_iterator(from), std::make_move_iterator(to));
+		other.erase(first, last);
+	}
+
+	void splice(const_iterator pos, Deque&& other, const_iterator first, const_iterator last) {
+		splice(pos, other, first, last);
+	}
+
+	void splice(const_iterator pos, Deque& other) {
+		if (&other == this) return;
+		splice(pos, other, other.begin(), other.end());
+	}
+
+	void splice(const_iterator pos, Deque&& other) {
+		splice(pos, other);
+	}
+
+	void splice(const_iterator pos, Deque& other, const_iterator it) {
+		splice(pos, other, it, it + 1);
+	}
+
+	void splice(const_iterator pos, Deque&& other, const_iterator it) {
+		splice(pos, other, it);
+	}
+
+	// Оба дека должны быть отсортированы по comp; при равенстве элементы *this идут раньше
+	template <typename Compare = std::less<>>
+	void merge(Deque& other, Compare comp = {}) {
+		if (&other == this || other.empty()) return;
+		size_t old_size = current_size;
+		bulk_push_back(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+		other.clear();
+		std::inplace_merge(begin(), begin() + old_size, end(), comp);
+	}
+
+	template <typename Compare = std::less<>>
+	void merge(Deque&& other, Compare comp = {}) {
+		merge(other, comp);
+	}
+
+	template <typename Compare = std::less<>>
+	void sort(Compare comp = {}) {
+		std::stable_sort(begin(), end(), comp);
+	}
+
+	template <typename BinaryPredicate = std::equal_to<>>
+	size_t unique(BinaryPredicate equal = {}) {
+		size_t removed = static_cast<size_t>(end() - std::unique(begin(), end(), equal));
+		for (size_t i = 0; i < removed; ++i) pop_back();
+		return removed;
+	}
+
+	void reverse() {
+		std::reverse(begin(), end());
+	}
+
+	bool operator==(const container_type& other) const override {
+		const Deque& other_deque = static_cast<const Deque&>(other);
+		return size() == other_deque.size() && std::equal(begin(), end(), other_deque.begin());
+	}
+
+	bool operator!=(const container_type& other) const override {
+		return !(*this == other);
+	}
+
+	bool operator<(const Deque& other) const {
+		return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+	}
+
+	bool operator<=(const Deque& other) const {
+		return !(other < *this);
+	}
+
+	bool operator>(const Deque& other) const {
+		return other < *this;
+	}
+
+	bool operator>=(const Deque& other) const {
+		return !(*this < other);
+	}
+
+	auto operator<=>(const Deque& other) const {
+		return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
 	}
 };
-}  // namespace my_container
\ No newline at end of file
+
+}  // namespace my_container
@@ -0,0 +1,389 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../../task1/include/container.hpp"
+
+namespace my_container {
+
+// Что делать с новым элементом, когда в буфере уже capacity() элементов
+enum class RingFull {
+    reject,     // push возвращает false, буфер не меняется
+    overwrite,  // вытесняется элемент с противоположного конца
+    throw_error,
+};
+
+namespace detail {
+
+// Кольцо из Slots ячеек (степень двойки): элемент с номером i лежит в ячейке (head + i) & mask
+template <typename T, size_t Slots>
+struct RingStorage {
+    static constexpr size_t mask = Slots - 1;
+
+    alignas(T) unsigned char bytes[sizeof(T) * Slots];
+    size_t head = 0;
+
+    T* slot(size_t index) const noexcept {
+        return reinterpret_cast<T*>(const_cast<unsigned char*>(bytes) + ((head + index) & mask) * sizeof(T));
+    }
+};
+
+}  // namespace detail
+
+template <typename T, size_t N, RingFull Policy>
+class RingDeque;
+
+// Итератор — номер элемента и указатель на кольцо; вставка и удаление в начале сдвигают номера
+template <typename T, size_t Slots, bool Const>
+class RingDequeIterator {
+private:
+    using Ring = detail::RingStorage<T, Slots>;
+
+    const Ring* ring_ = nullptr;
+    size_t index_ = 0;
+
+    template <typename, size_t, RingFull>
+    friend class RingDeque;
+    friend class RingDequeIterator<T, Slots, !Const>;
+
+    RingDequeIterator(const Ring* ring, size_t index) noexcept : ring_(ring), index_(index) {}
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    RingDequeIterator() = default;
+
+    template <bool OtherConst>
+        requires(Const && !OtherConst)
+    RingDequeIterator(const RingDequeIterator<T, Slots, OtherConst>& other) noexcept
+        : ring_(other.ring_), index_(other.index_) {}
+
+    reference operator*() const { return *ring_->slot(index_); }
+
+    pointer operator->() const { return ring_->slot(index_); }
+
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    RingDequeIterator& operator++() {
+        ++index_;
+        return *this;
+    }
+
+    RingDequeIterator operator++(int) {
+        RingDequeIterator copy = *this;
+        ++index_;
+        return copy;
+    }
+
+    RingDequeIterator& operator--() {
+        --index_;
+        return *this;
+    }
+
+    RingDequeIterator operator--(int) {
+        RingDequeIterator copy = *this;
+        --index_;
+        return copy;
+    }
+
+    RingDequeIterator& operator+=(difference_type n) {
+        index_ = static_cast<size_t>(static_cast<difference_type>(index_) + n);
+        return *this;
+    }
+
+    RingDequeIterator& operator-=(difference_type n) { return *this += -n; }
+
+    RingDequeIterator operator+(difference_type n) const {
+        RingDequeIterator copy = *this;
+        return copy += n;
+    }
+
+    friend RingDequeIterator operator+(difference_type n, const RingDequeIterator& it) { return it + n; }
+
+    RingDequeIterator operator-(difference_type n) const {
+        RingDequeIterator copy = *this;
+        return copy -= n;
+    }
+
+    template <bool OtherConst>
+    difference_type operator-(const RingDequeIterator<T, Slots, OtherConst>& other) const noexcept {
+        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+    }
+
+    template <bool OtherConst>
+    bool operator==(const RingDequeIterator<T, Slots, OtherConst>& other) const noexcept {
+        return index_ == other.index_;
+    }
+
+    template <bool OtherConst>
+    std::strong_ordering operator<=>(const RingDequeIterator<T, Slots, OtherConst>& other) const noexcept {
+        return index_ <=> other.index_;
+    }
+};
+
+// Дек на кольцевом буфере внутри объекта: не больше N элементов, куча не используется вовсе.
+// Ячеек — N, округлённое вверх до степени двойки, чтобы номер ячейки считался маской, а не делением.
+// push и emplace возвращают, попал ли элемент в буфер; при полном буфере поведение задаёт Policy.
+template <typename T, size_t N, RingFull Policy = RingFull::reject>
+class RingDeque : public Container<T, N, RingDequeIterator<T, std::bit_ceil(N), false>,
+                                   RingDequeIterator<T, std::bit_ceil(N), true>> {
+    static_assert(N > 0, "RingDeque capacity must be positive");
+
+private:
+    static constexpr size_t slots = std::bit_ceil(N);
+
+    detail::RingStorage<T, slots> ring;
+    size_t current_size = 0;
+
+    static void refuse() {
+        if constexpr (Policy == RingFull::throw_error) throw std::length_error("RingDeque is full");
+    }
+
+    template <typename It>
+    void append(It first, It last) {
+        try {
+            for (; first != last; ++first) emplace_back(*first);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using difference_type = std::ptrdiff_t;
+    using size_type = size_t;
+    using iterator = RingDequeIterator<T, slots, false>;
+    using const_iterator = RingDequeIterator<T, slots, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using container_type = Container<T, N, iterator, const_iterator>;
+
+    static constexpr RingFull full_policy = Policy;
+
+    RingDeque() = default;
+
+    RingDeque(const RingDeque& other) {
+        append(other.begin(), other.end());
+    }
+
+    // Элементы переносятся по одному; other остаётся пустым
+    RingDeque(RingDeque&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        append(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        other.clear();
+    }
+
+    RingDeque(std::initializer_list<T> init) {
+        append(init.begin(), init.end());
+    }
+
+    template <std::input_iterator InputIt>
+    RingDeque(InputIt first, InputIt last) {
+        append(first, last);
+    }
+
+    ~RingDeque() {
+        clear();
+    }
+
+    RingDeque& operator=(const RingDeque& other) {
+        if (this != &other) {
+            clear();
+            append(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    RingDeque& operator=(const container_type& other) override {
+        if (this == &other) return *this;
+
+        const RingDeque* other_deque = dynamic_cast<const RingDeque*>(&other);
+        if (!other_deque) {
+            throw std::invalid_argument("Container type mismatch in assignment");
+        }
+
+        return *this = *other_deque;
+    }
+
+    RingDeque& operator=(RingDeque&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            append(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        }
+        return *this;
+    }
+
+    T& at(size_t pos) { return const_cast<T&>(static_cast<const RingDeque*>(this)->at(pos)); }
+
+    const T& at(size_t pos) const {
+        if (pos >= current_size) throw std::out_of_range("RingDeque index out of range");
+        return *ring.slot(pos);
+    }
+
+    T& operator[](size_t pos) { return *ring.slot(pos); }
+
+    const T& operator[](size_t pos) const { return *ring.slot(pos); }
+
+    T& front() {
+        if (empty()) throw std::out_of_range("RingDeque is empty");
+        return *ring.slot(0);
+    }
+
+    const T& front() const {
+        if (empty()) throw std::out_of_range("RingDeque is empty");
+        return *ring.slot(0);
+    }
+
+    T& back() {
+        if (empty()) throw std::out_of_range("RingDeque is empty");
+        return *ring.slot(current_size - 1);
+    }
+
+    const T& back() const {
+        if (empty()) throw std::out_of_range("RingDeque is empty");
+        return *ring.slot(current_size - 1);
+    }
+
+    iterator begin() override { return iterator(&ring, 0); }
+    const_iterator begin() const override { return const_iterator(&ring, 0); }
+    const_iterator cbegin() const override { return begin(); }
+    iterator end() override { return iterator(&ring, current_size); }
+    const_iterator end() const override { return const_iterator(&ring, current_size); }
+    const_iterator cend() const override { return end(); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    bool empty() const override { return current_size == 0; }
+    bool full() const noexcept { return current_size == N; }
+    size_t size() const override { return current_size; }
+    size_t max_size() const override { return N; }
+    static constexpr size_t capacity() noexcept { return N; }
+
+    void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < current_size; ++i) std::destroy_at(ring.slot(i));
+        }
+        current_size = 0;
+    }
+
+    bool push_back(const T& value) { return emplace_back(value); }
+
+    bool push_back(T&& value) { return emplace_back(std::move(value)); }
+
+    // При вытеснении значение сначала строится во временном объекте: args могут ссылаться на вытесняемый элемент
+    template <typename... Args>
+    bool emplace_back(Args&&... args) {
+        if (full()) {
+            if constexpr (Policy == RingFull::overwrite) {
+                T value(std::forward<Args>(args)...);
+                pop_front();
+                return emplace_back(std::move(value));
+            } else {
+                refuse();
+                return false;
+            }
+        }
+        std::construct_at(ring.slot(current_size), std::forward<Args>(args)...);
+        ++current_size;
+        return true;
+    }
+
+    bool push_front(const T& value) { return emplace_front(value); }
+
+    bool push_front(T&& value) { return emplace_front(std::move(value)); }
+
+    template <typename... Args>
+    bool emplace_front(Args&&... args) {
+        if (full()) {
+            if constexpr (Policy == RingFull::overwrite) {
+                T value(std::forward<Args>(args)...);
+                pop_back();
+                return emplace_front(std::move(value));
+            } else {
+                refuse();
+                return false;
+            }
+        }
+        std::construct_at(ring.slot(slots - 1), std::forward<Args>(args)...);
+        ring.head = (ring.head - 1) & ring.mask;
+        ++current_size;
+        return true;
+    }
+
+    void pop_back() {
+        if (empty()) return;
+        std::destroy_at(ring.slot(current_size - 1));
+        --current_size;
+    }
+
+    void pop_front() {
+        if (empty()) return;
+        std::destroy_at(ring.slot(0));
+        ring.head = (ring.head + 1) & ring.mask;
+        --current_size;
+    }
+
+    // Поэлементный обмен: хранилище внутри объектов, переставить указатели нельзя
+    void swap(RingDeque& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>) {
+        if (this == &other) return;
+        RingDeque& shorter = current_size <= other.current_size ? *this : other;
+        RingDeque& longer = current_size <= other.current_size ? other : *this;
+        size_t common = shorter.current_size;
+        std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+        for (size_t i = common; i < longer.current_size; ++i) {
+            std::construct_at(shorter.ring.slot(i), std::move(*longer.ring.slot(i)));
+            ++shorter.current_size;
+        }
+        while (longer.current_size > common) longer.pop_back();
+    }
+
+    bool operator==(const container_type& other) const override {
+        const RingDeque& other_deque = static_cast<const RingDeque&>(other);
+        return size() == other_deque.size() && std::equal(begin(), end(), other_deque.begin());
+    }
+
+    bool operator!=(const container_type& other) const override {
+        return !(*this == other);
+    }
+
+    bool operator<(const RingDeque& other) const {
+        return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+    }
+
+    bool operator<=(const RingDeque& other) const {
+        return !(other < *this);
+    }
+
+    bool operator>(const RingDeque& other) const {
+        return other < *this;
+    }
+
+    bool operator>=(const RingDeque& other) const {
+        return !(*this < other);
+    }
+
+    auto operator<=>(const RingDeque& other) const {
+        return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
+    }
+};
+
+}  // namespace my_container
@@ -32,8 +32,8 @@ int main() {
 
 
         std::cout << "\nЭлементы дека: ";
-        for (auto it = dq.begin(); it != dq.end(); it = dq.next(it)) {
-            std::cout << *it << " ";
+        for (int value : dq) {
+            std::cout << value << " ";
         }
 
     } catch (const std::exception& e) {
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "../include/ring-deque.hpp"
+#include "../../task1/tests/test-utils.hpp"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace my_container;
+using test_utils::to_vector;
+
+TEST(RingDequeTest, InlineStorageAndWrapAround) {
+    static_assert(std::random_access_iterator<RingDeque<int, 8>::iterator>);
+    static_assert(std::random_access_iterator<RingDeque<int, 8>::const_iterator>);
+    static_assert(sizeof(RingDeque<int, 8>) < 8 * sizeof(int) + 4 * sizeof(void*));
+
+    RingDeque<int, 5> dq;
+    EXPECT_TRUE(dq.empty());
+    EXPECT_EQ(dq.capacity(), 5);
+    EXPECT_EQ(dq.max_size(), 5);
+    EXPECT_THROW(dq.front(), std::out_of_range);
+
+    for (int round = 0; round < 50; ++round) {
+        EXPECT_TRUE(dq.push_back(round));
+        EXPECT_TRUE(dq.push_front(-round));
+        if (dq.size() > 3) {
+            dq.pop_front();
+            dq.pop_back();
+        }
+    }
+    dq.clear();
+    for (int i = 0; i < 5; ++i) dq.push_back(i);
+    EXPECT_TRUE(dq.full());
+    EXPECT_EQ(to_vector(dq), (std::vector<int>{0, 1, 2, 3, 4}));
+    for (size_t i = 0; i < dq.size(); ++i) EXPECT_EQ(dq[i], static_cast<int>(i));
+    EXPECT_EQ(dq.at(4), 4);
+    EXPECT_THROW(dq.at(5), std::out_of_range);
+    EXPECT_EQ(*(dq.end() - 1), 4);
+    EXPECT_EQ(dq.rbegin()[1], 3);
+}
+
+TEST(RingDequeTest, RejectPolicyKeepsContents) {
+    RingDeque<int, 3> dq = {1, 2, 3};
+    EXPECT_FALSE(dq.push_back(4));
+    EXPECT_FALSE(dq.push_front(0));
+    EXPECT_FALSE(dq.emplace_back(5));
+    EXPECT_EQ(to_vector(dq), (std::vector<int>{1, 2, 3}));
+
+    RingDeque<int, 3> truncated = {1, 2, 3, 4, 5};
+    EXPECT_EQ(to_vector(truncated), (std::vector<int>{1, 2, 3}));
+}
+
+TEST(RingDequeTest, OverwritePolicyEvictsOppositeEnd) {
+    RingDeque<std::string, 3, RingFull::overwrite> dq;
+    for (int i = 0; i < 5; ++i) EXPECT_TRUE(dq.push_back(std::to_string(i)));
+    EXPECT_EQ(to_vector(dq), (std::vector<std::string>{"2", "3", "4"}));
+
+    EXPECT_TRUE(dq.push_front("x"));
+    EXPECT_EQ(to_vector(dq), (std::vector<std::string>{"x", "2", "3"}));
+
+    // Аргумент ссылается на вытесняемый элемент
+    EXPECT_TRUE(dq.push_back(dq.front()));
+    EXPECT_EQ(to_vector(dq), (std::vector<std::string>{"2", "3", "x"}));
+    EXPECT_TRUE(dq.emplace_front(dq.back()));
+    EXPECT_EQ(to_vector(dq), (std::vector<std::string>{"x", "2", "3"}));
+}
+
+TEST(RingDequeTest, ThrowPolicy) {
+    RingDeque<int, 2, RingFull::throw_error> dq;
+    dq.push_back(1);
+    dq.push_front(0);
+    EXPECT_THROW(dq.push_back(2), std::length_error);
+    EXPECT_THROW(dq.push_front(-1), std::length_error);
+    EXPECT_EQ(to_vector(dq), (std::vector<int>{0, 1}));
+    EXPECT_THROW((RingDeque<int, 2, RingFull::throw_error>{1, 2, 3}), std::length_error);
+}
+
+TEST(RingDequeTest, CopyMoveSwapCompare) {
+    RingDeque<std::string, 4> owners;
+    std::string payload(1000, 'p');
+    const char* buffer = payload.data();
+    owners.push_back(std::move(payload));
+    owners.emplace_front(3, 'a');
+    RingDeque<std::string, 4> moved(std::move(owners));
+    EXPECT_TRUE(owners.empty());
+    EXPECT_EQ(moved.front(), "aaa");
+    EXPECT_EQ(moved.back().data(), buffer);
+
+    RingDeque<std::string, 4> a = {"a", "b", "c"};
+    RingDeque<std::string, 4> b = {"z"};
+    a.pop_front();
+    a.push_back("d");
+    a.swap(b);
+    EXPECT_EQ(to_vector(a), (std::vector<std::string>{"z"}));
+    EXPECT_EQ(to_vector(b), (std::vector<std::string>{"b", "c", "d"}));
+    b.swap(b);
+    EXPECT_EQ(to_vector(b), (std::vector<std::string>{"b", "c", "d"}));
+
+    RingDeque<std::string, 4> copy(b);
+    EXPECT_TRUE(copy == b);
+    EXPECT_TRUE(b < a);
+    EXPECT_TRUE(a != b);
+
+    const RingDeque<std::string, 4>::container_type& base = a;
+    copy = base;
+    EXPECT_EQ(to_vector(copy), (std::vector<std::string>{"z"}));
+    copy = std::move(b);
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_TRUE(b.empty());
+}
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
 #include "../include/deque.hpp"
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../../task1/include/allocators.hpp"
 
 namespace my_container {
 
@@ -56,13 +62,13 @@ TEST(DequeTest, ElementAccess) {
 TEST(DequeTest, Iterators) {
 	Deque<int, 5> dq = {5, 10, 15};
 	int sum = 0;
-	for (auto it = dq.begin(); it != dq.end(); it = dq.next(it)) {
+	for (auto it = dq.begin(); it != dq.end(); ++it) {
 		sum += *it;
 	}
 	EXPECT_EQ(sum, 30);
 
 	sum = 0;
-	for (auto it = dq.rbegin(); it != dq.rend(); it = dq.prev(it)) {
+	for (auto it = dq.rbegin(); it != dq.rend(); ++it) {
 		sum += *it;
 	}
 	EXPECT_EQ(sum, 30);
@@ -119,7 +125,7 @@ TEST(DequeAssignmentTest, CopyAssignment) {
 	src.push_back(2);
 
 	Deque<int, 5> dest;
-	const Container<int, 5>& base_src = src;
+	const Deque<int, 5>::container_type& base_src = src;
 	dest = base_src;
 
 	ASSERT_EQ(dest.size(), 2);
@@ -154,7 +160,7 @@ TEST(DequeAssignmentTest, SelfAssignment) {
 	Deque<int, 5> deque;
 	deque.push_back(100);
 
-	const Container<int, 5>& base = deque;
+	const Deque<int, 5>::container_type& base = deque;
 	deque = base;
 	ASSERT_EQ(deque.size(), 1);
 	ASSERT_EQ(deque.front(), 100);
@@ -163,6 +169,181 @@ TEST(DequeAssignmentTest, SelfAssignment) {
 	ASSERT_EQ(deque.size(), 1);
 }
 
+TEST(DequeAllocatorTest, ArenaAllocator) {
+	Arena arena;
+	Deque<int, 0, ArenaAllocator<int>> dq({1, 2, 3}, ArenaAllocator<int>(arena));
+	dq.push_front(0);
+	dq.push_back(4);
+	for (int i = 0; i < 5; ++i) EXPECT_EQ(dq[i], i);
+
+	Deque<int, 0, ArenaAllocator<int>> copy(dq);
+	EXPECT_TRUE(copy == dq);
+	EXPECT_EQ(&copy.get_allocator().resource(), &arena);
+}
+
+TEST(DequeTest, EmplaceAndMove) {
+	Deque<std::string> dq;
+	std::string payload(1000, 'p');
+	const char* buffer = payload.data();
+	dq.push_back(std::move(payload));
+	EXPECT_EQ(dq.back().data(), buffer);
+
+	dq.emplace_front(2, 'a');
+	dq.emplace_back("z");
+	dq.push_front(std::string("first"));
+	auto it = dq.emplace(std::next(dq.begin(), 2), 3, 'm');
+	EXPECT_EQ(*it, "mmm");
+	EXPECT_EQ(dq.size(), 5);
+	EXPECT_EQ(dq[0], "first");
+	EXPECT_EQ(dq[1], "aa");
+	EXPECT_EQ(dq[2], "mmm");
+	EXPECT_EQ(dq[3].data(), buffer);
+	EXPECT_EQ(dq[4], "z");
+}
+
+TEST(DequeBlockTest, RandomAccessAndStableReferences) {
+	static_assert(std::random_access_iterator<Deque<int>::iterator>);
+	static_assert(std::random_access_iterator<Deque<int>::const_iterator>);
+
+	Deque<int> dq;
+	dq.push_back(0);
+	const int* first = &dq.front();
+	const size_t count = 10 * Deque<int>::elements_per_block;
+	for (size_t i = 1; i <= count; ++i) {
+		dq.push_back(static_cast<int>(i));
+		dq.push_front(-static_cast<int>(i));
+	}
+	EXPECT_EQ(&dq[count], first);
+	EXPECT_EQ(dq.size(), 2 * count + 1);
+	for (size_t i = 0; i < dq.size(); ++i) ASSERT_EQ(dq[i], static_cast<int>(i) - static_cast<int>(count));
+
+	auto it = dq.begin() + static_cast<std::ptrdiff_t>(count);
+	EXPECT_EQ(*it, 0);
+	EXPECT_EQ(it - dq.begin(), static_cast<std::ptrdiff_t>(count));
+	EXPECT_EQ(it[1], 1);
+	EXPECT_TRUE(dq.cbegin() < it);
+	EXPECT_EQ(*(dq.end() - 1), static_cast<int>(count));
+}
+
+TEST(DequeBlockTest, SlidingQueueKeepsOrder) {
+	Deque<std::string> queue;
+	int next_in = 0;
+	int next_out = 0;
+	for (int round = 0; round < 20000; ++round) {
+		queue.push_back(std::to_string(next_in++));
+		if (round % 3 != 0) {
+			ASSERT_EQ(queue.front(), std::to_string(next_out++));
+			queue.pop_front();
+		}
+	}
+	EXPECT_EQ(queue.size(), static_cast<size_t>(next_in - next_out));
+	while (!queue.empty()) {
+		ASSERT_EQ(queue.front(), std::to_string(next_out++));
+		queue.pop_front();
+	}
+	queue.pop_front();
+	EXPECT_THROW(queue.back(), std::out_of_range);
+}
+
+TEST(DequeBlockTest, MatchesStdDequeUnderRandomEdits) {
+	std::mt19937 gen(11);
+	Deque<int> dq;
+	std::deque<int> model;
+	for (int step = 0; step < 20000; ++step) {
+		size_t pos = gen() % (model.size() + 1);
+		auto offset = static_cast<std::ptrdiff_t>(pos);
+		switch (gen() % 6) {
+			case 0:
+				dq.push_back(step);
+				model.push_back(step);
+				break;
+			case 1:
+				dq.push_front(step);
+				model.push_front(step);
+				break;
+			case 2:
+				dq.insert(dq.begin() + offset, step);
+				model.insert(model.begin() + offset, step);
+				break;
+			case 3:
+				dq.pop_back();
+				if (!model.empty()) model.pop_back();
+				break;
+			case 4:
+				dq.pop_front();
+				if (!model.empty()) model.pop_front();
+				break;
+			default:
+				if (pos < model.size()) {
+					dq.erase(dq.begin() + offset);
+					model.erase(model.begin() + offset);
+				}
+				break;
+		}
+		ASSERT_EQ(dq.size(), model.size());
+	}
+	EXPECT_TRUE(std::equal(dq.begin(), dq.end(), model.begin(), model.end()));
+
+	auto first = dq.begin() + static_cast<std::ptrdiff_t>(dq.size() / 4);
+	auto last = dq.end() - static_cast<std::ptrdiff_t>(dq.size() / 4);
+	dq.erase(first, last);
+	model.erase(model.begin() + (first - dq.begin()), model.begin() + (last - dq.begin()));
+	EXPECT_TRUE(std::equal(dq.begin(), dq.end(), model.begin(), model.end()));
+}
+
+TEST(DequeBlockTest, ListOperations) {
+	Deque<int> dq = {5, 3, 3, 1, 4, 1, 5};
+	dq.sort();
+	EXPECT_EQ(std::vector<int>(dq.begin(), dq.end()), (std::vector<int>{1, 1, 3, 3, 4, 5, 5}));
+	EXPECT_EQ(dq.unique(), 3);
+	EXPECT_EQ(std::vector<int>(dq.begin(), dq.end()), (std::vector<int>{1, 3, 4, 5}));
+	dq.reverse();
+	EXPECT_EQ(std::vector<int>(dq.begin(), dq.end()), (std::vector<int>{5, 4, 3, 1}));
+
+	Deque<int> a = {1, 4, 7};
+	Deque<int> b = {2, 4, 8};
+	a.merge(b);
+	EXPECT_TRUE(b.empty());
+	EXPECT_EQ(std::vector<int>(a.begin(), a.end()), (std::vector<int>{1, 2, 4, 4, 7, 8}));
+
+	Deque<int> c = {10, 20, 30};
+	a.splice(a.begin() + 1, c, c.begin() + 1, c.end());
+	EXPECT_EQ(std::vector<int>(a.begin(), a.end()), (std::vector<int>{1, 20, 30, 2, 4, 4, 7, 8}));
+	EXPECT_EQ(std::vector<int>(c.begin(), c.end()), (std::vector<int>{10}));
+	a.splice(a.end(), a, a.begin(), a.begin() + 3);
+	EXPECT_EQ(std::vector<int>(a.begin(), a.end()), (std::vector<int>{2, 4, 4, 7, 8, 1, 20, 30}));
+	a.splice(a.begin(), c);
+	EXPECT_EQ(a.front(), 10);
+	EXPECT_TRUE(c.empty());
+
+	std::vector<int> more = {-1, -2};
+	a.insert(a.begin() + 2, more.begin(), more.end());
+	EXPECT_EQ(a[2], -1);
+	EXPECT_EQ(a[3], -2);
+	EXPECT_EQ(a.size(), 11);
+
+	a.assign(3, 9);
+	EXPECT_EQ(std::vector<int>(a.begin(), a.end()), (std::vector<int>{9, 9, 9}));
+}
+
+TEST(DequeBlockTest, FailedConstructionLeavesDequeIntact) {
+	struct Fragile {
+		int value;
+		explicit Fragile(int v) : value(v) {
+			if (v < 0) throw std::runtime_error("negative");
+		}
+		bool operator==(const Fragile&) const = default;
+	};
+	Deque<Fragile> dq;
+	for (size_t i = 0; i < Deque<Fragile>::elements_per_block; ++i) dq.emplace_back(static_cast<int>(i));
+	EXPECT_THROW(dq.emplace_back(-1), std::runtime_error);
+	EXPECT_THROW(dq.emplace_front(-1), std::runtime_error);
+	EXPECT_EQ(dq.size(), Deque<Fragile>::elements_per_block);
+	dq.emplace_back(100);
+	EXPECT_EQ(dq.back().value, 100);
+	EXPECT_EQ(dq.front().value, 0);
+}
+
 }  // namespace my_container
 
 int main(int argc, char** argv) {
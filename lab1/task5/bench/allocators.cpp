@@ -0,0 +1,46 @@
+#include <chrono>
+#include <cstdio>
+#include "../include/vector.hpp"
+#include "../../task1/include/allocators.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename Build>
+double measure(size_t rounds, Build build) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) build();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+}
+
+int main() {
+    // Запрос строит несколько небольших векторов и выбрасывает их целиком
+    const size_t vectors_per_request = 64;
+    const size_t rounds = 20000;
+
+    std::printf("build-then-discard %zu Vector<int> per request, us per request\n", vectors_per_request);
+    std::printf("%10s %12s %12s\n", "elements", "new/delete", "arena");
+    for (size_t count : {8, 64, 512}) {
+        double heap = measure(rounds, [&] {
+            for (size_t k = 0; k < vectors_per_request; ++k) {
+                Vector<int> v;
+                for (size_t i = 0; i < count; ++i) v.push_back(static_cast<int>(i));
+            }
+        });
+
+        Arena arena;
+        double arena_time = measure(rounds, [&] {
+            for (size_t k = 0; k < vectors_per_request; ++k) {
+                Vector<int, 0, ArenaAllocator<int>> v{ArenaAllocator<int>(arena)};
+                for (size_t i = 0; i < count; ++i) v.push_back(static_cast<int>(i));
+            }
+            arena.reset();
+        });
+
+        std::printf("%10zu %12.2f %12.2f\n", count, heap, arena_time);
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include "../include/vector.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename F>
+double seconds(size_t rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+template <typename T>
+void run(const char* name, size_t bytes) {
+    size_t count = bytes / sizeof(T);
+    Vector<T> a;
+    Vector<T> b;
+    a.reserve(count);
+    b.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        a.push_back(static_cast<T>(i % 97));
+        b.push_back(static_cast<T>(i % 97));
+    }
+    size_t rounds = std::max<size_t>(1, (size_t(256) << 20) / bytes);
+
+    volatile bool sink = false;
+    double scalar = seconds(rounds, [&] { sink = simd::detail::mismatch_scalar(a.data(), b.data(), count) == count; });
+    double eq = seconds(rounds, [&] { sink = a == b; });
+    double cmp = seconds(rounds, [&] { sink = (a <=> b) == 0; });
+    (void)sink;
+
+    double gb = 2.0 * static_cast<double>(count * sizeof(T)) / 1e9;
+    std::printf("%-8s %10zu KiB %10.2f %10.2f %10.2f %8.2fx\n", name, bytes >> 10, gb / scalar, gb / eq, gb / cmp,
+                scalar / eq);
+}
+
+}
+
+int main() {
+#ifdef MY_CONTAINER_SIMD_X86
+    std::printf("avx2: %s\n", simd::detail::has_avx2() ? "yes" : "no (sse2)");
+#endif
+    std::printf("%-8s %14s %10s %10s %10s %9s\n", "type", "size", "scalar", "==", "<=>", "speedup");
+    std::printf("%-8s %14s %10s %10s %10s\n", "", "", "GB/s", "GB/s", "GB/s");
+    for (size_t bytes : {size_t(4) << 10, size_t(256) << 10, size_t(16) << 20}) {
+        run<std::int8_t>("int8", bytes);
+        run<std::int32_t>("int32", bytes);
+        run<std::int64_t>("int64", bytes);
+        run<float>("float", bytes);
+        run<double>("double", bytes);
+    }
+    return 0;
+}
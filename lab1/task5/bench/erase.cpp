@@ -0,0 +1,42 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include "../include/vector.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename T, typename Make, typename Erase>
+double run(size_t count, Make make, Erase erase) {
+    Vector<T> v;
+    v.reserve(count);
+    for (size_t i = 0; i < count; ++i) v.push_back(make(i));
+    auto start = std::chrono::steady_clock::now();
+    erase(v);
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Каждый десятый элемент «просрочен»
+template <typename T, typename Make>
+void compare(const char* name, size_t count, Make make) {
+    auto expired = [](const T& item) { return item == T{} || std::hash<T>{}(item) % 10 == 0; };
+    double one_by_one = run<T>(count, make, [&](Vector<T>& v) {
+        for (size_t i = v.size(); i-- > 0;) {
+            if (expired(v[i])) v.erase(i);
+        }
+    });
+    double batch = run<T>(count, make, [&](Vector<T>& v) { v.erase_if(expired); });
+    std::printf("%-14s %10zu %14.2f %12.2f %8.0fx\n", name, count, one_by_one, batch, one_by_one / batch);
+}
+
+}
+
+int main() {
+    std::printf("%-14s %10s %14s %12s %9s\n", "element", "count", "erase(i), ms", "erase_if, ms", "speedup");
+    for (size_t count : {10'000, 100'000}) {
+        compare<int>("int", count, [](size_t i) { return static_cast<int>(i + 1); });
+        compare<std::string>("std::string", count, [](size_t i) { return std::string(24, 'a') + std::to_string(i); });
+    }
+    return 0;
+}
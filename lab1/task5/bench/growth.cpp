@@ -0,0 +1,53 @@
+#include <chrono>
+#include <cstdio>
+#include "../include/vector.hpp"
+
+using namespace my_container;
+
+namespace {
+
+struct Payload {
+    int values[16];
+    Payload() : values{} {}
+    explicit Payload(size_t seed) : values{} { values[0] = static_cast<int>(seed); }
+    bool operator==(const Payload& other) const { return values[0] == other.values[0]; }
+    auto operator<=>(const Payload& other) const { return values[0] <=> other.values[0]; }
+};
+
+template <typename T, typename Growth>
+void run(const char* name, size_t count, size_t rounds) {
+    using V = Vector<T, 0, std::allocator<T>, Growth, true>;
+    GrowthStats stats;
+    size_t capacity = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) {
+        V v;
+        for (size_t i = 0; i < count; ++i) v.push_back(T(i));
+        stats = v.stats();
+        capacity = v.capacity();
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+    std::printf("%-22s %10.2f %8zu %12.1f %10.1f%%\n", name, ms, stats.reallocations,
+                static_cast<double>(stats.bytes_copied) / (1 << 20),
+                100.0 * static_cast<double>(capacity - count) / static_cast<double>(count));
+}
+
+template <typename T>
+void run_all(const char* title, size_t count, size_t rounds) {
+    std::printf("\n%s: %zu elements, %zu bytes each\n", title, count, sizeof(T));
+    std::printf("%-22s %10s %8s %12s %11s\n", "policy", "ms", "reallocs", "MiB copied", "slack");
+    run<T, growth::Doubling>("2x", count, rounds);
+    run<T, growth::OneAndHalf>("1.5x", count, rounds);
+    run<T, growth::Additive<(1 << 16)>>("+65536", count, rounds);
+    run<T, growth::PageRounded<>>("2x, 4 KiB pages", count, rounds);
+    run<T, growth::PageRounded<growth::OneAndHalf>>("1.5x, 4 KiB pages", count, rounds);
+    run<T, growth::HugePageRounded<>>("2x, 2 MiB pages", count, rounds);
+}
+
+}
+
+int main() {
+    run_all<int>("int", 10'000'000, 5);
+    run_all<Payload>("Payload", 1'500'000, 5);
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include "../include/mapped-vector.hpp"
+#include "../include/vector.hpp"
+
+using namespace my_container;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double since(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+template <typename C>
+double sum(const C& c) {
+    double total = 0;
+    for (size_t i = 0; i < c.size(); ++i) total += c[i];
+    return total;
+}
+
+}
+
+// Сравнивает перезагрузку набора данных чтением файла в Vector и повторным отображением MappedVector.
+// Файлы остаются в page cache, так что измеряется копирование, а не диск.
+int main() {
+    const size_t count = size_t(1) << 24;
+    auto dir = std::filesystem::temp_directory_path();
+    auto raw_path = dir / "bench-mapped.raw";
+    auto mapped_path = dir / "bench-mapped.vec";
+
+    auto start = Clock::now();
+    {
+        Vector<double> v;
+        for (size_t i = 0; i < count; ++i) v.push_back(static_cast<double>(i));
+        FILE* file = std::fopen(raw_path.c_str(), "wb");
+        std::fwrite(v.data(), sizeof(double), v.size(), file);
+        std::fclose(file);
+    }
+    double vector_write = since(start);
+
+    start = Clock::now();
+    {
+        MappedVector<double> v(mapped_path, MapMode::create);
+        for (size_t i = 0; i < count; ++i) v.push_back(static_cast<double>(i));
+        v.flush(false);
+    }
+    double mapped_write = since(start);
+
+    start = Clock::now();
+    Vector<double> loaded(count);
+    {
+        FILE* file = std::fopen(raw_path.c_str(), "rb");
+        size_t read = std::fread(loaded.data(), sizeof(double), count, file);
+        std::fclose(file);
+        if (read != count) std::printf("short read\n");
+    }
+    double vector_load = since(start);
+    start = Clock::now();
+    double vector_sum = sum(loaded);
+    double vector_scan = since(start);
+
+    start = Clock::now();
+    MappedVector<double> mapped(mapped_path, MapMode::open);
+    double mapped_load = since(start);
+    mapped.advise(MapAdvice::sequential);
+    start = Clock::now();
+    double mapped_sum = sum(mapped);
+    double mapped_scan = since(start);
+
+    if (vector_sum != mapped_sum) std::printf("checksum mismatch\n");
+    std::printf("%zu doubles (%zu MiB)\n", count, count * sizeof(double) >> 20);
+    std::printf("%-28s %10s %10s %10s\n", "", "build, ms", "load, ms", "scan, ms");
+    std::printf("%-28s %10.1f %10.1f %10.1f\n", "Vector + fwrite/fread", vector_write, vector_load, vector_scan);
+    std::printf("%-28s %10.1f %10.3f %10.1f\n", "MappedVector", mapped_write, mapped_load, mapped_scan);
+
+    std::filesystem::remove(raw_path);
+    std::filesystem::remove(mapped_path);
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include "../include/vector.hpp"
+
+using namespace my_container;
+
+namespace {
+
+struct Payload {
+    int values[16];
+    Payload() : values{} {}
+    explicit Payload(size_t seed) : values{} { values[0] = static_cast<int>(seed); }
+    bool operator==(const Payload& other) const { return values[0] == other.values[0]; }
+    auto operator<=>(const Payload& other) const { return values[0] <=> other.values[0]; }
+};
+
+template <typename T, typename Make>
+double run(size_t count, size_t rounds, Make make) {
+    auto start = std::chrono::steady_clock::now();
+    size_t sink = 0;
+    for (size_t r = 0; r < rounds; ++r) {
+        Vector<T> v;
+        for (size_t i = 0; i < count; ++i) {
+            v.push_back(make(i));
+        }
+        sink += v.size();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (sink != count * rounds) std::printf("unexpected size\n");
+    return static_cast<double>(count * rounds) / elapsed / 1e6;
+}
+
+}
+
+int main() {
+    const size_t count = 1 << 20;
+    const size_t rounds = 20;
+
+    std::printf("%-24s %12s\n", "element", "Mops/s");
+    std::printf("%-24s %12.1f\n", "int", run<int>(count, rounds, [](size_t i) { return static_cast<int>(i); }));
+    std::printf("%-24s %12.1f\n", "double", run<double>(count, rounds, [](size_t i) { return static_cast<double>(i); }));
+    std::printf("%-24s %12.1f\n", "std::string (short)",
+                run<std::string>(count / 4, rounds, [](size_t i) { return std::to_string(i); }));
+    std::printf("%-24s %12.1f\n", "std::string (heap)",
+                run<std::string>(count / 4, rounds, [](size_t i) { return std::string(32, static_cast<char>('a' + i % 26)); }));
+    std::printf("%-24s %12.1f\n", "Payload (64 bytes)", run<Payload>(count / 4, rounds, [](size_t i) { return Payload(i); }));
+    return 0;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+
+namespace my_container {
+
+// Политика роста: по текущей ёмкости, требуемому размеру и размеру элемента возвращает новую ёмкость >= required
+template <typename P>
+concept GrowthPolicy = requires(size_t capacity, size_t required, size_t element_size) {
+    { P::grow(capacity, required, element_size) } -> std::convertible_to<size_t>;
+};
+
+namespace growth {
+
+struct Doubling {
+    static size_t grow(size_t capacity, size_t required, size_t) noexcept {
+        return std::max(capacity == 0 ? 1 : 2 * capacity, required);
+    }
+};
+
+// Освобождённые блоки в сумме успевают вместить следующий запрос, так что аллокатор может их переиспользовать
+struct OneAndHalf {
+    static size_t grow(size_t capacity, size_t required, size_t) noexcept {
+        return std::max(capacity + capacity / 2 + 1, required);
+    }
+};
+
+// Линейный рост: память тратится экономно, но push_back перестаёт быть амортизированно O(1)
+template <size_t Step = 1024>
+struct Additive {
+    static_assert(Step > 0, "Additive growth step must be positive");
+
+    static size_t grow(size_t capacity, size_t required, size_t) noexcept {
+        return std::max(capacity + Step, required);
+    }
+};
+
+// Округляет результат Inner вверх до целого числа страниц, чтобы не терять хвост последней страницы.
+// Запросы меньше страницы не округляются: маленьким векторам страница целиком не нужна.
+template <typename Inner = Doubling, size_t PageSize = 4096>
+struct PageRounded {
+    static_assert(GrowthPolicy<Inner>, "Inner must be a growth policy");
+    static_assert(PageSize > 0 && (PageSize & (PageSize - 1)) == 0, "PageSize must be a power of two");
+
+    static size_t grow(size_t capacity, size_t required, size_t element_size) noexcept {
+        size_t count = Inner::grow(capacity, required, element_size);
+        size_t bytes = count * element_size;
+        if (element_size == 0 || bytes < PageSize) return count;
+        size_t rounded = (bytes + PageSize - 1) & ~(PageSize - 1);
+        return rounded / element_size;
+    }
+};
+
+template <typename Inner = Doubling>
+using HugePageRounded = PageRounded<Inner, size_t(2) << 20>;
+
+}  // namespace growth
+
+// Счётчики перевыделений одного вектора
+struct GrowthStats {
+    size_t reallocations = 0;
+    size_t bytes_copied = 0;
+    size_t peak_capacity = 0;
+};
+
+}  // namespace my_container
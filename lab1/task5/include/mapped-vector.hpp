@@ -0,0 +1,424 @@
+#pragma once
+#include "../../task1/include/container.hpp"
+#include "../../task1/include/simd-compare.hpp"
+#include "growth-policy.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace my_container {
+
+enum class MapMode {
+    open_or_create,
+    create,  // существующий файл обнуляется
+    open,    // файл обязан существовать
+};
+
+enum class MapAdvice {
+    normal,
+    sequential,
+    random,
+    will_need,
+    dont_need,
+};
+
+// Вектор в файле: заголовок на первой странице, дальше элементы подряд.
+// При повторном открытии данные не читаются, а отображаются как есть, поэтому T должен быть тривиально копируемым
+// и файл переносим только между сборками с одинаковым представлением T.
+template <typename T, size_t N = 0, GrowthPolicy Growth = growth::PageRounded<>>
+class MappedVector : public Container<T, N> {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedVector stores elements as raw bytes");
+
+private:
+    static constexpr size_t header_bytes = 4096;
+    static_assert(alignof(T) <= header_bytes, "MappedVector element alignment exceeds the header size");
+
+    static constexpr char magic[8] = {'M', 'Y', 'V', 'E', 'C', 'T', 'O', 'R'};
+
+    struct Header {
+        char magic[8];
+        std::uint64_t element_size;
+        std::uint64_t size;
+    };
+
+    int fd_ = -1;
+    std::byte* base_ = nullptr;
+    size_t mapped_ = 0;
+    MapAdvice advice_ = MapAdvice::normal;
+    std::filesystem::path path_;
+
+    [[noreturn]] static void fail(const char* what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    Header* header() const noexcept {
+        return reinterpret_cast<Header*>(base_);
+    }
+
+    T* elements() const noexcept {
+        return reinterpret_cast<T*>(base_ + header_bytes);
+    }
+
+    void set_size(size_t size) noexcept {
+        header()->size = size;
+    }
+
+    void map(size_t bytes) {
+        void* address = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (address == MAP_FAILED) fail("MappedVector: mmap");
+        base_ = static_cast<std::byte*>(address);
+        mapped_ = bytes;
+    }
+
+    void remap(size_t bytes) {
+#ifdef MREMAP_MAYMOVE
+        void* address = ::mremap(base_, mapped_, bytes, MREMAP_MAYMOVE);
+        if (address == MAP_FAILED) fail("MappedVector: mremap");
+        base_ = static_cast<std::byte*>(address);
+        mapped_ = bytes;
+#else
+        std::byte* old_base = base_;
+        size_t old_mapped = mapped_;
+        map(bytes);
+        ::munmap(old_base, old_mapped);
+#endif
+        apply_advice(advice_);
+    }
+
+    // Файл растёт до отображения, а уменьшается после: обращение за конец файла даёт SIGBUS
+    void set_capacity(size_t capacity) {
+        size_t bytes = header_bytes + capacity * sizeof(T);
+        if (bytes == mapped_) return;
+        if (bytes > mapped_) {
+            if (::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) fail("MappedVector: ftruncate");
+            try {
+                remap(bytes);
+            } catch (...) {
+                [[maybe_unused]] int ignored = ::ftruncate(fd_, static_cast<off_t>(mapped_));
+                throw;
+            }
+        } else {
+            remap(bytes);
+            if (::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) fail("MappedVector: ftruncate");
+        }
+    }
+
+    void grow(size_t required) {
+        if (required > capacity()) set_capacity(Growth::grow(capacity(), required, sizeof(T)));
+    }
+
+    // Разовые подсказки (will_need, dont_need) не запоминаются: повторять их после mremap незачем,
+    // а dont_need при каждом росте выбрасывал бы уже загруженные страницы
+    static bool persistent(MapAdvice advice) noexcept {
+        return advice == MapAdvice::normal || advice == MapAdvice::sequential || advice == MapAdvice::random;
+    }
+
+    void apply_advice(MapAdvice which) noexcept {
+        int advice = MADV_NORMAL;
+        switch (which) {
+            case MapAdvice::normal: advice = MADV_NORMAL; break;
+            case MapAdvice::sequential: advice = MADV_SEQUENTIAL; break;
+            case MapAdvice::random: advice = MADV_RANDOM; break;
+            case MapAdvice::will_need: advice = MADV_WILLNEED; break;
+            case MapAdvice::dont_need: advice = MADV_DONTNEED; break;
+        }
+        // Подсказка необязательна, ошибку madvise игнорируем
+        if (base_) ::madvise(base_, mapped_, advice);
+    }
+
+    void close() noexcept {
+        if (base_) ::munmap(base_, mapped_);
+        if (fd_ >= 0) ::close(fd_);
+        base_ = nullptr;
+        mapped_ = 0;
+        fd_ = -1;
+    }
+
+    void open(MapMode mode) {
+        int flags = O_RDWR | O_CLOEXEC;
+        if (mode == MapMode::create) flags |= O_CREAT | O_TRUNC;
+        if (mode == MapMode::open_or_create) flags |= O_CREAT;
+        fd_ = ::open(path_.c_str(), flags, 0644);
+        if (fd_ < 0) fail("MappedVector: open");
+
+        struct stat st {};
+        if (::fstat(fd_, &st) != 0) fail("MappedVector: fstat");
+        size_t file_size = static_cast<size_t>(st.st_size);
+
+        if (file_size == 0) {
+            if (::ftruncate(fd_, static_cast<off_t>(header_bytes)) != 0) fail("MappedVector: ftruncate");
+            map(header_bytes);
+            std::memcpy(header()->magic, magic, sizeof(magic));
+            header()->element_size = sizeof(T);
+            header()->size = 0;
+            return;
+        }
+
+        if (file_size < header_bytes) throw std::runtime_error("MappedVector: file is too small");
+        map(file_size);
+        if (std::memcmp(header()->magic, magic, sizeof(magic)) != 0) {
+            throw std::runtime_error("MappedVector: not a MappedVector file");
+        }
+        if (header()->element_size != sizeof(T)) throw std::runtime_error("MappedVector: element size mismatch");
+        if (header()->size > capacity()) throw std::runtime_error("MappedVector: file is truncated");
+    }
+
+public:
+    using growth_policy = Growth;
+
+    explicit MappedVector(const std::filesystem::path& path, MapMode mode = MapMode::open_or_create) : path_(path) {
+        try {
+            open(mode);
+        } catch (...) {
+            close();
+            throw;
+        }
+    }
+
+    MappedVector(const MappedVector&) = delete;
+
+    // Перемещённый объект можно только уничтожить или присвоить
+    MappedVector(MappedVector&& other) noexcept
+        : fd_(std::exchange(other.fd_, -1)),
+          base_(std::exchange(other.base_, nullptr)),
+          mapped_(std::exchange(other.mapped_, 0)),
+          advice_(other.advice_),
+          path_(std::move(other.path_)) {}
+
+    ~MappedVector() override {
+        close();
+    }
+
+    MappedVector& operator=(MappedVector&& other) noexcept {
+        if (this != &other) {
+            close();
+            fd_ = std::exchange(other.fd_, -1);
+            base_ = std::exchange(other.base_, nullptr);
+            mapped_ = std::exchange(other.mapped_, 0);
+            advice_ = other.advice_;
+            path_ = std::move(other.path_);
+        }
+        return *this;
+    }
+
+    // Копирует элементы в свой файл; сами файлы не меняются местами
+    MappedVector& operator=(const MappedVector& other) {
+        if (this != &other) {
+            grow(other.size());
+            std::memcpy(static_cast<void*>(elements()), other.data(), other.size() * sizeof(T));
+            set_size(other.size());
+        }
+        return *this;
+    }
+
+    MappedVector& operator=(const Container<T, N>& other) override {
+        const MappedVector* other_vec = dynamic_cast<const MappedVector*>(&other);
+        if (!other_vec) {
+            throw std::invalid_argument("Invalid container type in MappedVector assignment");
+        }
+        return *this = *other_vec;
+    }
+
+    const std::filesystem::path& path() const noexcept {
+        return path_;
+    }
+
+    T& operator[](size_t pos) {
+        return elements()[pos];
+    }
+
+    const T& operator[](size_t pos) const {
+        return elements()[pos];
+    }
+
+    T& at(size_t pos) {
+        if (pos >= size()) throw std::out_of_range("MappedVector::at");
+        return elements()[pos];
+    }
+
+    const T& at(size_t pos) const {
+        if (pos >= size()) throw std::out_of_range("MappedVector::at");
+        return elements()[pos];
+    }
+
+    T& front() {
+        return elements()[0];
+    }
+
+    const T& front() const {
+        return elements()[0];
+    }
+
+    T& back() {
+        return elements()[size() - 1];
+    }
+
+    const T& back() const {
+        return elements()[size() - 1];
+    }
+
+    T* data() noexcept {
+        return base_ ? elements() : nullptr;
+    }
+
+    const T* data() const noexcept {
+        return base_ ? elements() : nullptr;
+    }
+
+    bool empty() const override {
+        return size() == 0;
+    }
+
+    size_t size() const override {
+        return base_ ? static_cast<size_t>(header()->size) : 0;
+    }
+
+    size_t capacity() const noexcept {
+        return base_ ? (mapped_ - header_bytes) / sizeof(T) : 0;
+    }
+
+    size_t max_size() const override {
+        return capacity();
+    }
+
+    void reserve(size_t new_cap) {
+        if (new_cap > capacity()) set_capacity(new_cap);
+    }
+
+    // Обрезает файл до занятой части
+    void shrink_to_fit() {
+        set_capacity(size());
+    }
+
+    void clear() noexcept {
+        if (base_) set_size(0);
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        // Аргумент может лежать в самом отображении, которое grow() переместит
+        T value(std::forward<Args>(args)...);
+        size_t pos = size();
+        grow(pos + 1);
+        std::memcpy(static_cast<void*>(elements() + pos), &value, sizeof(T));
+        set_size(pos + 1);
+        return elements()[pos];
+    }
+
+    void pop_back() {
+        if (size() > 0) set_size(size() - 1);
+    }
+
+    void insert(size_t pos, const T& value) {
+        size_t count = size();
+        if (pos > count) throw std::out_of_range("MappedVector::insert");
+        T copy = value;
+        grow(count + 1);
+        std::memmove(static_cast<void*>(elements() + pos + 1), elements() + pos, (count - pos) * sizeof(T));
+        std::memcpy(static_cast<void*>(elements() + pos), &copy, sizeof(T));
+        set_size(count + 1);
+    }
+
+    void erase(size_t pos) {
+        size_t count = size();
+        if (pos >= count) throw std::out_of_range("MappedVector::erase");
+        std::memmove(static_cast<void*>(elements() + pos), elements() + pos + 1, (count - pos - 1) * sizeof(T));
+        set_size(count - 1);
+    }
+
+    void resize(size_t count) {
+        size_t old_size = size();
+        if (count > old_size) {
+            grow(count);
+            std::uninitialized_value_construct(elements() + old_size, elements() + count);
+        }
+        set_size(count);
+    }
+
+    // Сбрасывает изменённые страницы на диск; wait = false только ставит запись в очередь
+    void flush(bool wait = true) {
+        if (!base_) return;
+        size_t bytes = header_bytes + size() * sizeof(T);
+        if (::msync(base_, bytes, wait ? MS_SYNC : MS_ASYNC) != 0) fail("MappedVector: msync");
+    }
+
+    // Подсказка ядру. Порядок доступа (normal, sequential, random) сохраняется при росте файла,
+    // will_need и dont_need применяются один раз к текущему отображению
+    void advise(MapAdvice advice) noexcept {
+        if (persistent(advice)) advice_ = advice;
+        apply_advice(advice);
+    }
+
+    T* begin() override {
+        return data();
+    }
+
+    const T* begin() const override {
+        return data();
+    }
+
+    const T* cbegin() const override {
+        return data();
+    }
+
+    T* end() override {
+        return data() + size();
+    }
+
+    const T* end() const override {
+        return data() + size();
+    }
+
+    const T* cend() const override {
+        return data() + size();
+    }
+
+    bool operator==(const Container<T, N>& other) const override {
+        const MappedVector* o = dynamic_cast<const MappedVector*>(&other);
+        if (!o || size() != o->size()) return false;
+        if constexpr (simd::Comparable<T>) {
+            return simd::equal(data(), o->data(), size());
+        } else {
+            for (size_t i = 0; i < size(); ++i) {
+                if ((*this)[i] != (*o)[i]) return false;
+            }
+            return true;
+        }
+    }
+
+    bool operator!=(const Container<T, N>& other) const override {
+        return !(*this == other);
+    }
+
+    auto operator<=>(const MappedVector& other) const {
+        if constexpr (simd::Comparable<T>) {
+            return simd::compare_three_way(data(), size(), other.data(), other.size());
+        } else {
+            size_t min_size = std::min(size(), other.size());
+            for (size_t i = 0; i < min_size; ++i) {
+                if ((*this)[i] != other[i]) {
+                    return (*this)[i] <=> other[i];
+                }
+            }
+            return size() <=> other.size();
+        }
+    }
+};
+
+}  // namespace my_container
@@ -0,0 +1,407 @@
+#pragma once
+#include "../../task1/include/container.hpp"
+#include <cstddef>
+#include <initializer_list>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace my_container {
+
+// Первые N элементов хранятся внутри объекта, в куче — только после переполнения
+template <typename T, size_t N = 16>
+class SmallVector : public Container<T, N> {
+private:
+    alignas(T) unsigned char inline_[sizeof(T) * (N ? N : 1)];
+    T* data_ = inline_data();
+    size_t size_ = 0;
+    size_t capacity_ = N;
+
+    T* inline_data() noexcept {
+        return reinterpret_cast<T*>(inline_);
+    }
+
+    static T* allocate(size_t count) {
+        return count ? std::allocator<T>().allocate(count) : nullptr;
+    }
+
+    void deallocate_storage() {
+        if (!is_inline()) std::allocator<T>().deallocate(data_, capacity_);
+        data_ = inline_data();
+        capacity_ = N;
+    }
+
+    static void relocate(T* first, T* last, T* dest) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move(first, last, dest);
+        } else {
+            std::uninitialized_copy(first, last, dest);
+        }
+    }
+
+    static void destroy_range(T* first, T* last) {
+        while (last != first) std::destroy_at(--last);
+    }
+
+    size_t next_capacity() const {
+        return capacity_ == 0 ? 1 : 2 * capacity_;
+    }
+
+    void reallocate(size_t new_capacity) {
+        T* new_data = new_capacity > N ? allocate(new_capacity) : inline_data();
+        if (new_data == data_) return;
+        try {
+            relocate(data_, data_ + size_, new_data);
+        } catch (...) {
+            if (new_data != inline_data()) std::allocator<T>().deallocate(new_data, new_capacity);
+            throw;
+        }
+        destroy_range(data_, data_ + size_);
+        deallocate_storage();
+        data_ = new_data;
+        capacity_ = std::max(new_capacity, N);
+    }
+
+    template <typename... Args>
+    void realloc_emplace(size_t pos, Args&&... args) {
+        size_t new_capacity = next_capacity();
+        T* new_data = allocate(new_capacity);
+        try {
+            std::construct_at(new_data + pos, std::forward<Args>(args)...);
+        } catch (...) {
+            std::allocator<T>().deallocate(new_data, new_capacity);
+            throw;
+        }
+        try {
+            relocate(data_, data_ + pos, new_data);
+        } catch (...) {
+            std::destroy_at(new_data + pos);
+            std::allocator<T>().deallocate(new_data, new_capacity);
+            throw;
+        }
+        try {
+            relocate(data_ + pos, data_ + size_, new_data + pos + 1);
+        } catch (...) {
+            destroy_range(new_data, new_data + pos + 1);
+            std::allocator<T>().deallocate(new_data, new_capacity);
+            throw;
+        }
+        destroy_range(data_, data_ + size_);
+        deallocate_storage();
+        data_ = new_data;
+        capacity_ = new_capacity;
+        ++size_;
+    }
+
+    void steal(SmallVector& other) {
+        if (other.is_inline()) {
+            std::uninitialized_move(other.data_, other.data_ + other.size_, data_);
+            size_ = other.size_;
+            other.clear();
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+    }
+
+public:
+    SmallVector() = default;
+
+    explicit SmallVector(size_t count) {
+        reserve(count);
+        try {
+            std::uninitialized_value_construct(data_, data_ + count);
+        } catch (...) {
+            deallocate_storage();
+            throw;
+        }
+        size_ = count;
+    }
+
+    SmallVector(const SmallVector& other) {
+        reserve(other.size_);
+        try {
+            std::uninitialized_copy(other.data_, other.data_ + other.size_, data_);
+        } catch (...) {
+            deallocate_storage();
+            throw;
+        }
+        size_ = other.size_;
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        steal(other);
+    }
+
+    SmallVector(std::initializer_list<T> init) {
+        reserve(init.size());
+        try {
+            std::uninitialized_copy(init.begin(), init.end(), data_);
+        } catch (...) {
+            deallocate_storage();
+            throw;
+        }
+        size_ = init.size();
+    }
+
+    ~SmallVector() override {
+        destroy_range(data_, data_ + size_);
+        deallocate_storage();
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+            std::uninitialized_copy(other.data_, other.data_ + other.size_, data_);
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(const Container<T, N>& other) override {
+        if (this == &other) return *this;
+
+        const SmallVector* other_vec = dynamic_cast<const SmallVector*>(&other);
+        if (!other_vec) {
+            throw std::invalid_argument("Invalid container type in SmallVector assignment");
+        }
+        return *this = *other_vec;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            deallocate_storage();
+            steal(other);
+        }
+        return *this;
+    }
+
+    T& operator[](size_t pos) {
+        return data_[pos];
+    }
+
+    const T& operator[](size_t pos) const {
+        return data_[pos];
+    }
+
+    T& at(size_t pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("SmallVector::at");
+        }
+        return data_[pos];
+    }
+
+    const T& at(size_t pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("SmallVector::at");
+        }
+        return data_[pos];
+    }
+
+    T& front() {
+        return data_[0];
+    }
+
+    const T& front() const {
+        return data_[0];
+    }
+
+    T& back() {
+        return data_[size_ - 1];
+    }
+
+    const T& back() const {
+        return data_[size_ - 1];
+    }
+
+    T* data() noexcept {
+        return data_;
+    }
+
+    const T* data() const noexcept {
+        return data_;
+    }
+
+    bool is_inline() const noexcept {
+        return data_ == reinterpret_cast<const T*>(inline_);
+    }
+
+    static constexpr size_t inline_capacity() noexcept {
+        return N;
+    }
+
+    bool empty() const override {
+        return size_ == 0;
+    }
+
+    size_t size() const override {
+        return size_;
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    void reserve(size_t new_cap) {
+        if (new_cap > capacity_) {
+            reallocate(new_cap);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (!is_inline() && capacity_ > size_) {
+            reallocate(size_);
+        }
+    }
+
+    void clear() {
+        destroy_range(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ >= capacity_) {
+            realloc_emplace(size_, std::forward<Args>(args)...);
+        } else {
+            std::construct_at(data_ + size_, std::forward<Args>(args)...);
+            ++size_;
+        }
+        return data_[size_ - 1];
+    }
+
+    void pop_back() {
+        if (size_ > 0) {
+            std::destroy_at(data_ + --size_);
+        }
+    }
+
+    template <typename... Args>
+    T* emplace(size_t pos, Args&&... args) {
+        if (pos > size_) throw std::out_of_range("SmallVector::emplace");
+        if (pos == size_) {
+            emplace_back(std::forward<Args>(args)...);
+            return data_ + pos;
+        }
+        if (size_ >= capacity_) {
+            realloc_emplace(pos, std::forward<Args>(args)...);
+            return data_ + pos;
+        }
+
+        T value(std::forward<Args>(args)...);
+        std::construct_at(data_ + size_, std::move(data_[size_ - 1]));
+        ++size_;
+        std::move_backward(data_ + pos, data_ + size_ - 2, data_ + size_ - 1);
+        data_[pos] = std::move(value);
+        return data_ + pos;
+    }
+
+    void insert(size_t pos, const T& value) {
+        if (pos > size_) throw std::out_of_range("SmallVector::insert");
+        emplace(pos, value);
+    }
+
+    void insert(size_t pos, T&& value) {
+        if (pos > size_) throw std::out_of_range("SmallVector::insert");
+        emplace(pos, std::move(value));
+    }
+
+    void erase(size_t pos) {
+        if (pos >= size_) throw std::out_of_range("SmallVector::erase");
+        std::move(data_ + pos + 1, data_ + size_, data_ + pos);
+        std::destroy_at(data_ + --size_);
+    }
+
+    void resize(size_t count) {
+        if (count < size_) {
+            destroy_range(data_ + count, data_ + size_);
+            size_ = count;
+            return;
+        }
+        if (count > capacity_) reserve(count);
+        std::uninitialized_value_construct(data_ + size_, data_ + count);
+        size_ = count;
+    }
+
+    size_t max_size() const override {
+        return capacity_;
+    }
+
+    void swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this == &other) return;
+        if (!is_inline() && !other.is_inline()) {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+            return;
+        }
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    T* begin() override {
+        return data_;
+    }
+
+    const T* begin() const override {
+        return data_;
+    }
+
+    const T* cbegin() const override {
+        return data_;
+    }
+
+    T* end() override {
+        return data_ + size_;
+    }
+
+    const T* end() const override {
+        return data_ + size_;
+    }
+
+    const T* cend() const override {
+        return data_ + size_;
+    }
+
+    bool operator==(const Container<T, N>& other) const override {
+        const SmallVector* o = dynamic_cast<const SmallVector*>(&other);
+        if (!o || size_ != o->size_) return false;
+        for (size_t i = 0; i < size_; ++i) {
+            if (data_[i] != o->data_[i]) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const Container<T, N>& other) const override {
+        return !(*this == other);
+    }
+
+    auto operator<=>(const SmallVector& other) const {
+        size_t min_size = std::min(size_, other.size_);
+        for (size_t i = 0; i < min_size; ++i) {
+            if (data_[i] != other.data_[i]) {
+                return data_[i] <=> other.data_[i];
+            }
+        }
+        return size_ <=> other.size_;
+    }
+};
+
+}
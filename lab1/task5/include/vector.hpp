@@ -1,107 +1,306 @@
 #pragma once
 #include "../../task1/include/container.hpp"
+#include "../../task1/include/simd-compare.hpp"
+#include "growth-policy.hpp"
 #include <cstddef>
 #include <initializer_list>
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace my_container {
 
-template <typename T, size_t N = 0>
+// Growth задаёт новую ёмкость при переполнении; TrackStats включает счётчики перевыделений (stats())
+template <typename T, size_t N = 0, typename Alloc = std::allocator<T>, GrowthPolicy Growth = growth::Doubling,
+          bool TrackStats = false>
 class Vector : public Container<T, N> {
 private:
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    struct NoStats {};
+
     T* data_ = nullptr;
     size_t size_ = 0;
     size_t capacity_ = 0;
+    [[no_unique_address]] Alloc alloc_;
+    [[no_unique_address]] std::conditional_t<TrackStats, GrowthStats, NoStats> stats_;
+
+    T* allocate(size_t count) {
+        return count ? AllocTraits::allocate(alloc_, count) : nullptr;
+    }
+
+    void deallocate(T* ptr, size_t count) {
+        if (ptr) AllocTraits::deallocate(alloc_, ptr, count);
+    }
+
+    static void relocate(T* first, T* last, T* dest) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move(first, last, dest);
+        } else {
+            std::uninitialized_copy(first, last, dest);
+        }
+    }
+
+    // Уничтожаем с конца, как delete[]: так освобождение не дробит кучу
+    static void destroy_range(T* first, T* last) {
+        while (last != first) std::destroy_at(--last);
+    }
+
+    size_t grown_capacity(size_t required) const {
+        return Growth::grow(capacity_, required, sizeof(T));
+    }
+
+    void note_capacity() noexcept {
+        if constexpr (TrackStats) stats_.peak_capacity = std::max(stats_.peak_capacity, capacity_);
+    }
+
+    // Вызывается после смены буфера; relocated — сколько элементов перенесено из старого
+    void note_reallocation(size_t relocated) noexcept {
+        if constexpr (TrackStats) {
+            ++stats_.reallocations;
+            stats_.bytes_copied += relocated * sizeof(T);
+        }
+        note_capacity();
+    }
 
     void reallocate(size_t new_capacity) {
-        T* new_data = new T[new_capacity];
-        for (size_t i = 0; i < size_; ++i) {
-            new_data[i] = std::move(data_[i]);
+        T* new_data = allocate(new_capacity);
+        try {
+            relocate(data_, data_ + size_, new_data);
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        destroy_range(data_, data_ + size_);
+        deallocate(data_, capacity_);
+        data_ = new_data;
+        capacity_ = new_capacity;
+        note_reallocation(size_);
+    }
+
+    template <typename... Args>
+    void realloc_emplace(size_t pos, Args&&... args) {
+        size_t new_capacity = grown_capacity(size_ + 1);
+        T* new_data = allocate(new_capacity);
+        try {
+            std::construct_at(new_data + pos, std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        try {
+            relocate(data_, data_ + pos, new_data);
+        } catch (...) {
+            std::destroy_at(new_data + pos);
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        try {
+            relocate(data_ + pos, data_ + size_, new_data + pos + 1);
+        } catch (...) {
+            destroy_range(new_data, new_data + pos + 1);
+            deallocate(new_data, new_capacity);
+            throw;
         }
-        delete[] data_;
+        destroy_range(data_, data_ + size_);
+        deallocate(data_, capacity_);
         data_ = new_data;
         capacity_ = new_capacity;
+        note_reallocation(size_);
+        ++size_;
+    }
+
+    template <typename Construct, typename Assign>
+    void insert_gap(size_t pos, size_t count, Construct construct, Assign assign) {
+        if (count == 0) return;
+        if (size_ + count > capacity_) {
+            size_t new_capacity = grown_capacity(size_ + count);
+            T* new_data = allocate(new_capacity);
+            try {
+                construct(new_data + pos, 0, count);
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            try {
+                relocate(data_, data_ + pos, new_data);
+            } catch (...) {
+                destroy_range(new_data + pos, new_data + pos + count);
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            try {
+                relocate(data_ + pos, data_ + size_, new_data + pos + count);
+            } catch (...) {
+                destroy_range(new_data, new_data + pos + count);
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            destroy_range(data_, data_ + size_);
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = new_capacity;
+            note_reallocation(size_);
+            size_ += count;
+            return;
+        }
+
+        // Хвост сдвигается один раз: часть уходит в неинициализированную память, остальное — присваиванием
+        T* old_end = data_ + size_;
+        size_t tail = size_ - pos;
+        if (tail > count) {
+            std::uninitialized_move(old_end - count, old_end, old_end);
+            size_ += count;
+            std::move_backward(data_ + pos, old_end - count, old_end);
+            assign(data_ + pos, 0, count);
+        } else {
+            construct(old_end, tail, count - tail);
+            size_ += count - tail;
+            std::uninitialized_move(data_ + pos, old_end, data_ + pos + count);
+            size_ += tail;
+            assign(data_ + pos, 0, tail);
+        }
+    }
+
+    template <typename It>
+    void insert_counted(size_t pos, It first, size_t count) {
+        insert_gap(
+            pos, count,
+            [first](T* dest, size_t offset, size_t n) { std::uninitialized_copy_n(std::ranges::next(first, offset), n, dest); },
+            [first](T* dest, size_t offset, size_t n) { std::copy_n(std::ranges::next(first, offset), n, dest); });
+    }
+
+    void swap_storage(Vector& other) noexcept {
+        using std::swap;
+        swap(data_, other.data_);
+        swap(size_, other.size_);
+        swap(capacity_, other.capacity_);
+        swap(alloc_, other.alloc_);
     }
 
 public:
+    using allocator_type = Alloc;
+    using growth_policy = Growth;
+
     Vector() = default;
 
-    explicit Vector(size_t count) : data_(new T[count]), size_(count), capacity_(count) {}
+    explicit Vector(const Alloc& alloc) : alloc_(alloc) {}
 
-    Vector(const Vector& other) : data_(new T[other.capacity_]), size_(other.size_), capacity_(other.capacity_) {
-        for (size_t i = 0; i < size_; ++i) {
-            data_[i] = other.data_[i];
+    explicit Vector(size_t count, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+        data_ = allocate(count);
+        capacity_ = count;
+        try {
+            std::uninitialized_value_construct(data_, data_ + count);
+        } catch (...) {
+            deallocate(data_, capacity_);
+            throw;
+        }
+        size_ = count;
+        note_capacity();
+    }
+
+    Vector(const Vector& other) : Vector(other, AllocTraits::select_on_container_copy_construction(other.alloc_)) {}
+
+    Vector(const Vector& other, const Alloc& alloc) : alloc_(alloc) {
+        data_ = allocate(other.capacity_);
+        capacity_ = other.capacity_;
+        try {
+            std::uninitialized_copy(other.data_, other.data_ + other.size_, data_);
+        } catch (...) {
+            deallocate(data_, capacity_);
+            throw;
         }
+        size_ = other.size_;
+        note_capacity();
     }
 
-    Vector(Vector&& other) noexcept 
-        : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+    Vector(Vector&& other) noexcept
+        : data_(other.data_), size_(other.size_), capacity_(other.capacity_), alloc_(std::move(other.alloc_)) {
         other.data_ = nullptr;
         other.size_ = 0;
         other.capacity_ = 0;
+        note_capacity();
     }
 
-    Vector(std::initializer_list<T> init) : data_(new T[init.size()]), size_(init.size()), capacity_(init.size()) {
-        std::copy(init.begin(), init.end(), data_);
+    Vector(std::initializer_list<T> init, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+        data_ = allocate(init.size());
+        capacity_ = init.size();
+        try {
+            std::uninitialized_copy(init.begin(), init.end(), data_);
+        } catch (...) {
+            deallocate(data_, capacity_);
+            throw;
+        }
+        size_ = init.size();
+        note_capacity();
     }
 
     ~Vector() override {
-        delete[] data_;
+        destroy_range(data_, data_ + size_);
+        deallocate(data_, capacity_);
     }
 
     Vector& operator=(const Vector& other) {
         if (this != &other) {
-            delete[] data_;
-            size_ = other.size_;
-            capacity_ = other.capacity_;
-            data_ = new T[capacity_];
-            for (size_t i = 0; i < size_; ++i) {
-                data_[i] = other.data_[i];
-            }
+            Vector copy(other, AllocTraits::propagate_on_container_copy_assignment::value ? other.alloc_ : alloc_);
+            swap_storage(copy);
+            note_capacity();
         }
         return *this;
     }
     Vector& operator=(const Container<T, N>& other) override {
         if (this == &other) return *this;
-    
+
         const Vector* other_vec = dynamic_cast<const Vector*>(&other);
         if (!other_vec) {
             throw std::invalid_argument("Invalid container type in Vector assignment");
         }
-    
+
+        clear();
         if (other_vec->size_ > capacity_) {
-            delete[] data_;
-            data_ = new T[other_vec->capacity_];
-            capacity_ = other_vec->capacity_;
-        }
-    
-        size_ = 0;
-        try {
-            for (size_t i = 0; i < other_vec->size_; ++i) {
-                data_[i] = other_vec->data_[i];
-                ++size_;
-            }
-        } catch (...) {
-            delete[] data_;
+            deallocate(data_, capacity_);
             data_ = nullptr;
-            size_ = capacity_ = 0;
-            throw;
+            capacity_ = 0;
+            data_ = allocate(other_vec->capacity_);
+            capacity_ = other_vec->capacity_;
+            note_capacity();
         }
-    
+
+        std::uninitialized_copy(other_vec->data_, other_vec->data_ + other_vec->size_, data_);
+        size_ = other_vec->size_;
+
         return *this;
     }
 
-    Vector& operator=(Vector&& other) noexcept {
-        if (this != &other) {
-            delete[] data_;
-            data_ = other.data_;
-            size_ = other.size_;
-            capacity_ = other.capacity_;
-            other.data_ = nullptr;
-            other.size_ = 0;
-            other.capacity_ = 0;
+    Vector& operator=(Vector&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value ||
+                                               AllocTraits::is_always_equal::value) {
+        if (this == &other) return *this;
+        if constexpr (!AllocTraits::propagate_on_container_move_assignment::value &&
+                      !AllocTraits::is_always_equal::value) {
+            if (alloc_ != other.alloc_) {
+                clear();
+                insert_counted(0, std::make_move_iterator(other.data_), other.size_);
+                other.clear();
+                return *this;
+            }
+        }
+        destroy_range(data_, data_ + size_);
+        deallocate(data_, capacity_);
+        if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
         }
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+        note_capacity();
         return *this;
     }
 
@@ -176,50 +375,145 @@ public:
     }
 
     void clear() {
+        destroy_range(data_, data_ + size_);
         size_ = 0;
     }
 
     void push_back(const T& value) {
-        if (size_ >= capacity_) {
-            reserve(capacity_ == 0 ? 1 : 2 * capacity_);
-        }
-        data_[size_++] = value;
+        emplace_back(value);
     }
 
     void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
         if (size_ >= capacity_) {
-            reserve(capacity_ == 0 ? 1 : 2 * capacity_);
+            realloc_emplace(size_, std::forward<Args>(args)...);
+        } else {
+            std::construct_at(data_ + size_, std::forward<Args>(args)...);
+            ++size_;
         }
-        data_[size_++] = std::move(value);
+        return data_[size_ - 1];
     }
 
     void pop_back() {
         if (size_ > 0) {
-            --size_;
+            std::destroy_at(data_ + --size_);
         }
     }
 
+    template <typename... Args>
+    T* emplace(size_t pos, Args&&... args) {
+        if (pos > size_) throw std::out_of_range("Vector::emplace");
+        if (pos == size_) {
+            emplace_back(std::forward<Args>(args)...);
+            return data_ + pos;
+        }
+        if (size_ >= capacity_) {
+            realloc_emplace(pos, std::forward<Args>(args)...);
+            return data_ + pos;
+        }
+
+        // Аргументы могут ссылаться на элементы вектора, поэтому сначала строим значение
+        T value(std::forward<Args>(args)...);
+        std::construct_at(data_ + size_, std::move(data_[size_ - 1]));
+        ++size_;
+        std::move_backward(data_ + pos, data_ + size_ - 2, data_ + size_ - 1);
+        data_[pos] = std::move(value);
+        return data_ + pos;
+    }
+
     void insert(size_t pos, const T& value) {
         if (pos > size_) throw std::out_of_range("Vector::insert");
-        if (size_ >= capacity_) reserve(capacity_ == 0 ? 1 : 2 * capacity_);
-        
-        for (size_t i = size_; i > pos; --i) {
-            data_[i] = std::move(data_[i-1]);
+        emplace(pos, value);
+    }
+
+    void insert(size_t pos, T&& value) {
+        if (pos > size_) throw std::out_of_range("Vector::insert");
+        emplace(pos, std::move(value));
+    }
+
+    void insert(size_t pos, size_t count, const T& value) {
+        if (pos > size_) throw std::out_of_range("Vector::insert");
+        T copy(value);
+        insert_gap(
+            pos, count,
+            [&copy](T* dest, size_t, size_t n) { std::uninitialized_fill_n(dest, n, copy); },
+            [&copy](T* dest, size_t, size_t n) { std::fill_n(dest, n, copy); });
+    }
+
+    template <std::input_iterator InputIt>
+    void insert(size_t pos, InputIt first, InputIt last) {
+        if (pos > size_) throw std::out_of_range("Vector::insert");
+        if constexpr (std::forward_iterator<InputIt>) {
+            insert_counted(pos, first, static_cast<size_t>(std::distance(first, last)));
+        } else if (pos == size_) {
+            for (; first != last; ++first) emplace_back(*first);
+        } else {
+            Vector buffer;
+            for (; first != last; ++first) buffer.emplace_back(*first);
+            insert_counted(pos, std::make_move_iterator(buffer.begin()), buffer.size());
+        }
+    }
+
+    void insert(size_t pos, std::initializer_list<T> init) {
+        insert(pos, init.begin(), init.end());
+    }
+
+    template <std::ranges::input_range Range>
+    void append_range(Range&& range) {
+        if constexpr (std::ranges::forward_range<Range>) {
+            insert_counted(size_, std::ranges::begin(range), static_cast<size_t>(std::ranges::distance(range)));
+        } else {
+            if constexpr (std::ranges::sized_range<Range>) reserve(size_ + std::ranges::size(range));
+            for (auto&& item : range) emplace_back(std::forward<decltype(item)>(item));
         }
-        data_[pos] = value;
-        ++size_;
     }
 
     void erase(size_t pos) {
         if (pos >= size_) throw std::out_of_range("Vector::erase");
-        for (size_t i = pos; i < size_-1; ++i) {
-            data_[i] = std::move(data_[i+1]);
+        std::move(data_ + pos + 1, data_ + size_, data_ + pos);
+        std::destroy_at(data_ + --size_);
+    }
+
+    // Хвост сдвигается один раз, освободившиеся в конце элементы уничтожаются
+    void erase(size_t first, size_t last) {
+        if (first > last || last > size_) throw std::out_of_range("Vector::erase");
+        if (first == last) return;
+        T* new_end = std::move(data_ + last, data_ + size_, data_ + first);
+        destroy_range(new_end, data_ + size_);
+        size_ = static_cast<size_t>(new_end - data_);
+    }
+
+    // Один проход с уплотнением; возвращает число удалённых элементов
+    template <typename Pred>
+    size_t erase_if(Pred pred) {
+        T* old_end = data_ + size_;
+        T* new_end = std::remove_if(data_, old_end, std::ref(pred));
+        destroy_range(new_end, old_end);
+        size_ = static_cast<size_t>(new_end - data_);
+        return static_cast<size_t>(old_end - new_end);
+    }
+
+    size_t remove(const T& value) {
+        // Значение из самого вектора будет перезаписано при сдвиге, поэтому сравниваем с копией
+        if (std::less_equal<const T*>()(data_, &value) && std::less<const T*>()(&value, data_ + size_)) {
+            T copy(value);
+            return erase_if([&copy](const T& item) { return item == copy; });
         }
-        --size_;
+        return erase_if([&value](const T& item) { return item == value; });
     }
 
     void resize(size_t count) {
+        if (count < size_) {
+            destroy_range(data_ + count, data_ + size_);
+            size_ = count;
+            return;
+        }
         if (count > capacity_) reserve(count);
+        std::uninitialized_value_construct(data_ + size_, data_ + count);
         size_ = count;
     }
 
@@ -228,11 +522,34 @@ public:
     }
 
     void swap(Vector& other) noexcept {
-        std::swap(data_, other.data_);
-        std::swap(size_, other.size_);
-        std::swap(capacity_, other.capacity_);
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            swap_storage(other);
+        } else {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+        }
+        note_capacity();
+        other.note_capacity();
     }
 
+    allocator_type get_allocator() const {
+        return alloc_;
+    }
+
+    // Перевыделения считаются с первого выделения буфера; peak_capacity — наибольшая ёмкость за жизнь объекта
+    const GrowthStats& stats() const noexcept
+        requires TrackStats
+    {
+        return stats_;
+    }
+
+    void reset_stats() noexcept
+        requires TrackStats
+    {
+        stats_ = GrowthStats{};
+        stats_.peak_capacity = capacity_;
+    }
 
     T* begin() override {
         return data_;
@@ -261,10 +578,14 @@ public:
     bool operator==(const Container<T, N>& other) const override {
         const Vector* o = dynamic_cast<const Vector*>(&other);
         if (!o || size_ != o->size_) return false;
-        for (size_t i = 0; i < size_; ++i) {
-            if (data_[i] != o->data_[i]) return false;
+        if constexpr (simd::Comparable<T>) {
+            return simd::equal(data_, o->data_, size_);
+        } else {
+            for (size_t i = 0; i < size_; ++i) {
+                if (data_[i] != o->data_[i]) return false;
+            }
+            return true;
         }
-        return true;
     }
 
     bool operator!=(const Container<T, N>& other) const override {
@@ -272,14 +593,18 @@ public:
     }
 
     auto operator<=>(const Vector& other) const {
-        size_t min_size = std::min(size_, other.size_);
-        for (size_t i = 0; i < min_size; ++i) {
-            if (data_[i] != other.data_[i]) {
-                return data_[i] <=> other.data_[i];
+        if constexpr (simd::Comparable<T>) {
+            return simd::compare_three_way(data_, size_, other.data_, other.size_);
+        } else {
+            size_t min_size = std::min(size_, other.size_);
+            for (size_t i = 0; i < min_size; ++i) {
+                if (data_[i] != other.data_[i]) {
+                    return data_[i] <=> other.data_[i];
+                }
             }
+            return size_ <=> other.size_;
         }
-        return size_ <=> other.size_;
     }
 };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include "../include/mapped-vector.hpp"
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+
+using namespace my_container;
+
+namespace {
+
+struct Point {
+    double x;
+    double y;
+    bool operator==(const Point&) const = default;
+    auto operator<=>(const Point&) const = default;
+};
+
+class MappedVectorTest : public ::testing::Test {
+protected:
+    std::filesystem::path path_;
+
+    void SetUp() override {
+        path_ = std::filesystem::temp_directory_path() /
+                ("mapped-vector-" + std::to_string(::getpid()) + "-" +
+                 ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove(path_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path_);
+    }
+};
+
+}
+
+TEST_F(MappedVectorTest, PersistsAcrossReopen) {
+    {
+        MappedVector<int> v(path_, MapMode::create);
+        EXPECT_TRUE(v.empty());
+        for (int i = 0; i < 10000; ++i) v.push_back(i);
+        EXPECT_EQ(v.size(), 10000);
+        v.flush();
+    }
+    MappedVector<int> v(path_, MapMode::open);
+    ASSERT_EQ(v.size(), 10000);
+    for (int i = 0; i < 10000; ++i) EXPECT_EQ(v[i], i);
+    v.push_back(-1);
+    EXPECT_EQ(v.back(), -1);
+}
+
+TEST_F(MappedVectorTest, GrowsAndShrinksFile) {
+    MappedVector<Point> v(path_);
+    v.reserve(1000);
+    EXPECT_GE(v.capacity(), 1000);
+    size_t reserved = std::filesystem::file_size(path_);
+    EXPECT_GE(reserved, 1000 * sizeof(Point));
+
+    v.resize(10);
+    EXPECT_EQ(v[9], (Point{0, 0}));
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 10);
+    EXPECT_LT(std::filesystem::file_size(path_), reserved);
+
+    v.emplace_back(Point{1, 2});
+    v.advise(MapAdvice::sequential);
+    for (int i = 0; i < 5000; ++i) v.push_back(v.back());
+    EXPECT_EQ(v.size(), 5011);
+    EXPECT_EQ(v[5010], (Point{1, 2}));
+    v.advise(MapAdvice::random);
+    v.flush(false);
+
+    // Разовая подсказка: страницы файла выбрасываются один раз, данные остаются в файле
+    v.advise(MapAdvice::dont_need);
+    EXPECT_EQ(v[5010], (Point{1, 2}));
+    v.advise(MapAdvice::will_need);
+    for (double i = 0; i < 5000; ++i) v.push_back(Point{i, i});
+    EXPECT_EQ(v[5010], (Point{1, 2}));
+    EXPECT_EQ(v[10010], (Point{4999, 4999}));
+}
+
+TEST_F(MappedVectorTest, Modifiers) {
+    MappedVector<int> v(path_);
+    for (int i = 0; i < 5; ++i) v.push_back(i * 10);
+    v.insert(0, -10);
+    v.insert(6, 50);
+    v.erase(3);
+    ASSERT_EQ(v.size(), 6);
+    int expected[] = {-10, 0, 10, 30, 40, 50};
+    for (size_t i = 0; i < 6; ++i) EXPECT_EQ(v.at(i), expected[i]);
+
+    int sum = 0;
+    for (int x : v) sum += x;
+    EXPECT_EQ(sum, 120);
+
+    v.pop_back();
+    EXPECT_EQ(v.back(), 40);
+    EXPECT_THROW(v.at(5), std::out_of_range);
+    EXPECT_THROW(v.insert(6, 0), std::out_of_range);
+    EXPECT_THROW(v.erase(5), std::out_of_range);
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
+
+TEST_F(MappedVectorTest, OpenModesAndValidation) {
+    EXPECT_THROW(MappedVector<int>(path_, MapMode::open), std::system_error);
+
+    {
+        MappedVector<int> v(path_);
+        v.push_back(1);
+    }
+    EXPECT_THROW(MappedVector<double>(path_, MapMode::open), std::runtime_error);
+
+    MappedVector<int> recreated(path_, MapMode::create);
+    EXPECT_TRUE(recreated.empty());
+}
+
+TEST_F(MappedVectorTest, MoveAndCompare) {
+    MappedVector<int> a(path_);
+    for (int i = 0; i < 100; ++i) a.push_back(i);
+
+    MappedVector<int> b(std::move(a));
+    EXPECT_EQ(b.size(), 100);
+    EXPECT_EQ(a.size(), 0);
+    EXPECT_EQ(a.data(), nullptr);
+
+    auto other_path = path_;
+    other_path += ".copy";
+    {
+        MappedVector<int> c(other_path, MapMode::create);
+        c = b;
+        EXPECT_TRUE(c == b);
+        c[50] = 1000;
+        EXPECT_TRUE(c != b);
+        EXPECT_TRUE(b < c);
+
+        Container<int, 0>& base = b;
+        c = base;
+        EXPECT_TRUE(c == b);
+    }
+    std::filesystem::remove(other_path);
+}
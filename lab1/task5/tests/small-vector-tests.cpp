@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "../include/small-vector.hpp"
+#include <stdexcept>
+#include <string>
+
+using namespace my_container;
+
+TEST(SmallVectorTest, StaysInlineUpToN) {
+    SmallVector<int, 4> v;
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 4);
+
+    for (int i = 0; i < 4; ++i) v.push_back(i);
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.size(), 4);
+
+    v.push_back(4);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_GE(v.capacity(), 5);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i);
+}
+
+TEST(SmallVectorTest, ShrinkReturnsInline) {
+    SmallVector<std::string, 2> v = {"a", "b", "c"};
+    EXPECT_FALSE(v.is_inline());
+    v.pop_back();
+    v.shrink_to_fit();
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 2);
+    EXPECT_EQ(v[1], "b");
+}
+
+TEST(SmallVectorTest, CopyInlineAndSpilled) {
+    SmallVector<std::string, 3> small = {"x", "y"};
+    SmallVector<std::string, 3> big = {"1", "2", "3", "4"};
+
+    SmallVector<std::string, 3> small_copy(small);
+    SmallVector<std::string, 3> big_copy(big);
+    EXPECT_TRUE(small_copy.is_inline());
+    EXPECT_FALSE(big_copy.is_inline());
+    EXPECT_TRUE(small_copy == small);
+    EXPECT_TRUE(big_copy == big);
+
+    small_copy = big;
+    EXPECT_EQ(small_copy.size(), 4);
+    EXPECT_EQ(small_copy[3], "4");
+
+    big_copy = small;
+    EXPECT_EQ(big_copy.size(), 2);
+    EXPECT_EQ(big_copy[0], "x");
+
+    Container<std::string, 3>& base = small;
+    SmallVector<std::string, 3> from_base;
+    from_base = base;
+    EXPECT_TRUE(from_base == small);
+}
+
+TEST(SmallVectorTest, MoveInlineAndSpilled) {
+    SmallVector<std::string, 3> small = {"x", "y"};
+    SmallVector<std::string, 3> moved_small(std::move(small));
+    EXPECT_TRUE(moved_small.is_inline());
+    EXPECT_TRUE(small.empty());
+    EXPECT_EQ(moved_small[1], "y");
+
+    SmallVector<std::string, 3> big = {"1", "2", "3", "4"};
+    const std::string* heap = big.data();
+    SmallVector<std::string, 3> moved_big(std::move(big));
+    EXPECT_EQ(moved_big.data(), heap);
+    EXPECT_TRUE(big.empty());
+    EXPECT_TRUE(big.is_inline());
+
+    moved_small = std::move(moved_big);
+    EXPECT_EQ(moved_small.size(), 4);
+    EXPECT_EQ(moved_small.data(), heap);
+
+    big.push_back("reuse");
+    EXPECT_EQ(big.back(), "reuse");
+}
+
+TEST(SmallVectorTest, SwapMixedStates) {
+    SmallVector<int, 2> a = {1};
+    SmallVector<int, 2> b = {5, 6, 7};
+    a.swap(b);
+    EXPECT_EQ(a.size(), 3);
+    EXPECT_FALSE(a.is_inline());
+    EXPECT_EQ(a[2], 7);
+    EXPECT_EQ(b.size(), 1);
+    EXPECT_TRUE(b.is_inline());
+    EXPECT_EQ(b[0], 1);
+
+    SmallVector<int, 2> c = {8, 9};
+    b.swap(c);
+    EXPECT_EQ(b[1], 9);
+    EXPECT_EQ(c[0], 1);
+}
+
+TEST(SmallVectorTest, Modifiers) {
+    SmallVector<int, 4> v = {1, 3};
+    v.insert(1, 2);
+    v.emplace(0, 0);
+    v.emplace_back(4);
+    EXPECT_EQ(v.size(), 5);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(v.at(i), i);
+
+    v.erase(0);
+    EXPECT_EQ(v.front(), 1);
+    v.resize(2);
+    EXPECT_EQ(v.back(), 2);
+    v.resize(6);
+    EXPECT_EQ(v[5], 0);
+
+    EXPECT_THROW(v.at(6), std::out_of_range);
+    EXPECT_THROW(v.insert(7, 0), std::out_of_range);
+    EXPECT_THROW(v.erase(6), std::out_of_range);
+
+    SmallVector<int, 4> w = {1, 2, 0};
+    EXPECT_TRUE(w < v);
+}
+
+TEST(SmallVectorTest, ZeroInlineCapacity) {
+    SmallVector<int, 0> v;
+    EXPECT_EQ(v.capacity(), 0);
+    v.push_back(1);
+    v.push_back(2);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_EQ(v[1], 2);
+}
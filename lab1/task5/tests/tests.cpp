@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 #include "../include/vector.hpp"
+#include "../../task1/include/allocators.hpp"
 #include <stdexcept>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <string>
 
 using namespace my_container;
 
@@ -167,6 +172,407 @@ TEST(VectorTest, SwapMethod) {
     EXPECT_EQ(v2.size(), 3);
 }
 
+namespace {
+
+struct Tracked {
+    static inline int alive = 0;
+    static inline int default_constructed = 0;
+    int value;
+
+    Tracked() : value(0) { ++alive; ++default_constructed; }
+    explicit Tracked(int v) : value(v) { ++alive; }
+    Tracked(const Tracked& other) : value(other.value) { ++alive; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++alive; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) noexcept = default;
+    ~Tracked() { --alive; }
+    bool operator==(const Tracked& other) const { return value == other.value; }
+
+    static void reset() { alive = default_constructed = 0; }
+};
+
+struct NoDefault {
+    int value;
+    explicit NoDefault(int v) : value(v) {}
+    bool operator==(const NoDefault& other) const { return value == other.value; }
+};
+
+}
+
+TEST(VectorTest, ReserveDoesNotConstruct) {
+    Tracked::reset();
+    {
+        Vector<Tracked> v;
+        v.reserve(100);
+        EXPECT_EQ(Tracked::alive, 0);
+        v.push_back(Tracked(1));
+        v.push_back(Tracked(2));
+        EXPECT_EQ(Tracked::alive, 2);
+        EXPECT_EQ(Tracked::default_constructed, 0);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorTest, ElementLifetime) {
+    Tracked::reset();
+    {
+        Vector<Tracked> v;
+        for (int i = 0; i < 10; ++i) v.push_back(Tracked(i));
+        EXPECT_EQ(Tracked::alive, 10);
+
+        v.pop_back();
+        EXPECT_EQ(Tracked::alive, 9);
+
+        v.erase(0);
+        EXPECT_EQ(Tracked::alive, 8);
+        EXPECT_EQ(v[0].value, 1);
+
+        v.insert(2, Tracked(42));
+        EXPECT_EQ(Tracked::alive, 9);
+        EXPECT_EQ(v[2].value, 42);
+        EXPECT_EQ(v[3].value, 3);
+
+        v.resize(12);
+        EXPECT_EQ(Tracked::alive, 12);
+        EXPECT_EQ(Tracked::default_constructed, 3);
+
+        v.resize(4);
+        EXPECT_EQ(Tracked::alive, 4);
+
+        v.clear();
+        EXPECT_EQ(Tracked::alive, 0);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorTest, NonDefaultConstructible) {
+    Vector<NoDefault> v;
+    for (int i = 0; i < 5; ++i) v.push_back(NoDefault(i));
+    v.insert(0, NoDefault(-1));
+    v.erase(1);
+    v.reserve(32);
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(v.front().value, -1);
+    EXPECT_EQ(v.back().value, 4);
+
+    Vector<NoDefault> copy(v);
+    EXPECT_EQ(copy[2].value, 2);
+}
+
+TEST(VectorTest, PushBackSelfReference) {
+    Vector<std::string> v = {"a", "b"};
+    v.shrink_to_fit();
+    v.push_back(v[0]);
+    v.insert(0, v[2]);
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_EQ(v[0], "a");
+    EXPECT_EQ(v[3], "a");
+}
+
+namespace {
+
+struct Heavy {
+    static inline int constructed = 0;
+    static inline int copies = 0;
+    static inline int moves = 0;
+    std::string name;
+    int id;
+
+    Heavy(std::string n, int i) : name(std::move(n)), id(i) { ++constructed; }
+    Heavy(const Heavy& other) : name(other.name), id(other.id) { ++copies; }
+    Heavy(Heavy&& other) noexcept : name(std::move(other.name)), id(other.id) { ++moves; }
+    Heavy& operator=(const Heavy& other) = default;
+    Heavy& operator=(Heavy&& other) noexcept = default;
+    bool operator==(const Heavy& other) const { return id == other.id && name == other.name; }
+
+    static void reset() { constructed = copies = moves = 0; }
+};
+
+}
+
+TEST(VectorTest, EmplaceBackConstructsInPlace) {
+    Vector<Heavy> v;
+    v.reserve(4);
+    Heavy::reset();
+
+    Heavy& ref = v.emplace_back("first", 1);
+    EXPECT_EQ(&ref, &v.back());
+    v.emplace_back("second", 2);
+
+    EXPECT_EQ(Heavy::constructed, 2);
+    EXPECT_EQ(Heavy::copies, 0);
+    EXPECT_EQ(Heavy::moves, 0);
+    EXPECT_EQ(v[1].name, "second");
+}
+
+TEST(VectorTest, EmplaceAtPosition) {
+    Vector<Heavy> v;
+    v.emplace_back("a", 1);
+    v.emplace_back("c", 3);
+    Heavy::reset();
+
+    Heavy* it = v.emplace(1, "b", 2);
+    EXPECT_EQ(it, v.data() + 1);
+    EXPECT_EQ(Heavy::constructed, 1);
+    EXPECT_EQ(Heavy::copies, 0);
+    EXPECT_EQ(v[0].id, 1);
+    EXPECT_EQ(v[1].id, 2);
+    EXPECT_EQ(v[2].id, 3);
+
+    v.reserve(8);
+    v.emplace(0, "z", 0);
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_EQ(v.front().name, "z");
+    EXPECT_EQ(v.back().name, "c");
+
+    EXPECT_THROW(v.emplace(10, "x", 9), std::out_of_range);
+}
+
+TEST(VectorTest, InsertRvalue) {
+    Vector<Heavy> v;
+    v.reserve(4);
+    v.emplace_back("a", 1);
+    v.emplace_back("b", 2);
+    Heavy::reset();
+
+    v.insert(1, Heavy("x", 7));
+    EXPECT_EQ(Heavy::copies, 0);
+    EXPECT_EQ(v[1].name, "x");
+    EXPECT_EQ(v[2].name, "b");
+}
+
+TEST(VectorTest, EmplaceAliasingElement) {
+    Vector<std::string> v = {"one", "two", "three"};
+    v.emplace(0, v[2]);
+    v.reserve(10);
+    v.emplace(1, v[3]);
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(v[0], "three");
+    EXPECT_EQ(v[1], "three");
+    EXPECT_EQ(v[2], "one");
+    EXPECT_EQ(v[4], "three");
+}
+
+TEST(VectorTest, InsertRangeSingleReallocation) {
+    Vector<int> v = {1, 2, 6, 7};
+    const int batch[] = {3, 4, 5};
+
+    v.insert(2, std::begin(batch), std::end(batch));
+    EXPECT_EQ(v.size(), 7);
+    for (int i = 0; i < 7; ++i) EXPECT_EQ(v[i], i + 1);
+
+    v.reserve(20);
+    const int* storage = v.data();
+    v.insert(0, {-2, -1, 0});
+    v.insert(5, 2, 42);
+    EXPECT_EQ(v.data(), storage);
+    EXPECT_EQ(v.size(), 12);
+    EXPECT_EQ(v[0], -2);
+    EXPECT_EQ(v[3], 1);
+    EXPECT_EQ(v[5], 42);
+    EXPECT_EQ(v[6], 42);
+    EXPECT_EQ(v[7], 3);
+    EXPECT_EQ(v.back(), 7);
+
+    EXPECT_THROW(v.insert(13, 1, 0), std::out_of_range);
+}
+
+TEST(VectorTest, InsertRangeShortTail) {
+    Vector<std::string> v = {"a", "b", "f"};
+    v.reserve(10);
+    Vector<std::string> batch = {"c", "d", "e"};
+    v.insert(2, batch.begin(), batch.end());
+    EXPECT_EQ(v.size(), 6);
+    EXPECT_EQ(v[1], "b");
+    EXPECT_EQ(v[2], "c");
+    EXPECT_EQ(v[4], "e");
+    EXPECT_EQ(v[5], "f");
+
+    v.insert(6, 2, v[0]);
+    EXPECT_EQ(v.size(), 8);
+    EXPECT_EQ(v.back(), "a");
+}
+
+TEST(VectorTest, InsertInputIterators) {
+    std::istringstream in("4 5 6");
+    Vector<int> v = {1, 2, 3, 7};
+    v.insert(3, std::istream_iterator<int>(in), std::istream_iterator<int>());
+    EXPECT_EQ(v.size(), 7);
+    for (int i = 0; i < 7; ++i) EXPECT_EQ(v[i], i + 1);
+}
+
+TEST(VectorTest, AppendRange) {
+    Vector<int> v = {1, 2};
+    v.append_range(std::views::iota(3, 6));
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(v.back(), 5);
+
+    Vector<int> more = {6, 7};
+    v.append_range(more);
+    EXPECT_EQ(v.size(), 7);
+    EXPECT_EQ(v.back(), 7);
+
+    v.append_range(v);
+    EXPECT_EQ(v.size(), 14);
+    EXPECT_EQ(v[7], 1);
+    EXPECT_EQ(v[13], 7);
+}
+
+TEST(VectorTest, ArenaAllocator) {
+    Arena arena;
+    ArenaAllocator<std::string> alloc(arena);
+    {
+        Vector<std::string, 0, ArenaAllocator<std::string>> v(alloc);
+        for (int i = 0; i < 100; ++i) v.push_back(std::string(40, 'a' + i % 26));
+        v.insert(0, {"x", "y"});
+        EXPECT_EQ(v.size(), 102);
+        EXPECT_EQ(v[0], "x");
+        EXPECT_EQ(&v.get_allocator().resource(), &arena);
+
+        Vector<std::string, 0, ArenaAllocator<std::string>> copy(v);
+        EXPECT_TRUE(copy == v);
+
+        Vector<std::string, 0, ArenaAllocator<std::string>> moved(std::move(copy));
+        EXPECT_EQ(moved.size(), 102);
+    }
+    EXPECT_GT(arena.bytes_reserved(), 0u);
+    arena.reset();
+}
+
+TEST(VectorTest, PoolAllocatorSwapAndAssign) {
+    Pool first_pool;
+    Pool second_pool;
+    using PoolVector = Vector<int, 0, PoolAllocator<int>>;
+    PoolVector a({1, 2, 3}, PoolAllocator<int>(first_pool));
+    PoolVector b({4, 5}, PoolAllocator<int>(second_pool));
+
+    a.swap(b);
+    EXPECT_EQ(a.size(), 2);
+    EXPECT_EQ(&a.get_allocator().resource(), &second_pool);
+
+    a = b;
+    EXPECT_EQ(a.size(), 3);
+    EXPECT_EQ(&a.get_allocator().resource(), &first_pool);
+
+    b = std::move(a);
+    EXPECT_EQ(b.back(), 3);
+}
+
+TEST(VectorTest, SimdComparisons) {
+    Vector<double> a;
+    Vector<double> b;
+    for (int i = 0; i < 100; ++i) {
+        a.push_back(i * 0.5);
+        b.push_back(i * 0.5);
+    }
+    EXPECT_TRUE(a == b);
+    EXPECT_TRUE((a <=> b) == 0);
+
+    b[77] = 100.0;
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE(a < b);
+
+    b[77] = a[77];
+    b.push_back(0.0);
+    EXPECT_TRUE(a < b);
+
+    Vector<char> s = {'a', 'b', 'c'};
+    Vector<char> t = {'a', 'b', 'd'};
+    EXPECT_TRUE(s < t);
+}
+
+TEST(VectorTest, BatchErase) {
+    Tracked::reset();
+    {
+        Vector<Tracked> v;
+        for (int i = 0; i < 20; ++i) v.emplace_back(i);
+
+        v.erase(2, 5);
+        EXPECT_EQ(v.size(), 17);
+        EXPECT_EQ(Tracked::alive, 17);
+        EXPECT_EQ(v[2].value, 5);
+
+        v.erase(3, 3);
+        EXPECT_EQ(v.size(), 17);
+        EXPECT_THROW(v.erase(4, 3), std::out_of_range);
+        EXPECT_THROW(v.erase(10, 18), std::out_of_range);
+
+        size_t removed = v.erase_if([](const Tracked& t) { return t.value % 2 == 0; });
+        EXPECT_EQ(removed, 8);
+        EXPECT_EQ(v.size(), 9);
+        EXPECT_EQ(Tracked::alive, 9);
+        for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i].value % 2, 1);
+
+        v.erase(0, v.size());
+        EXPECT_TRUE(v.empty());
+        EXPECT_EQ(Tracked::alive, 0);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorTest, RemoveValue) {
+    Vector<std::string> v = {"a", "b", "a", "c", "a"};
+    EXPECT_EQ(v.remove("a"), 3);
+    ASSERT_EQ(v.size(), 2);
+    EXPECT_EQ(v[0], "b");
+    EXPECT_EQ(v[1], "c");
+    EXPECT_EQ(v.remove("z"), 0);
+
+    Vector<std::string> w = {"x", "y", "x", "x"};
+    EXPECT_EQ(w.remove(w[0]), 3);
+    ASSERT_EQ(w.size(), 1);
+    EXPECT_EQ(w[0], "y");
+}
+
+TEST(VectorTest, GrowthPolicies) {
+    EXPECT_EQ(growth::Doubling::grow(0, 1, 4), 1);
+    EXPECT_EQ(growth::Doubling::grow(8, 9, 4), 16);
+    EXPECT_EQ(growth::Doubling::grow(8, 40, 4), 40);
+    EXPECT_EQ(growth::OneAndHalf::grow(0, 1, 4), 1);
+    EXPECT_EQ(growth::OneAndHalf::grow(10, 11, 4), 16);
+    EXPECT_EQ(growth::Additive<100>::grow(300, 301, 4), 400);
+
+    using Paged = growth::PageRounded<growth::Doubling, 4096>;
+    EXPECT_EQ(Paged::grow(16, 17, 8), 32);
+    EXPECT_EQ(Paged::grow(1000, 1001, 8), 2048);
+    EXPECT_EQ(Paged::grow(300, 301, 24), 682);
+
+    Vector<int, 0, std::allocator<int>, growth::Additive<10>> v;
+    for (int i = 0; i < 25; ++i) v.push_back(i);
+    EXPECT_EQ(v.capacity(), 30);
+    v.insert(0, 10, -1);
+    EXPECT_EQ(v.capacity(), 40);
+    EXPECT_EQ(v[10], 0);
+    EXPECT_EQ(v.back(), 24);
+}
+
+TEST(VectorTest, GrowthStats) {
+    Vector<int, 0, std::allocator<int>, growth::Doubling, true> v;
+    EXPECT_EQ(v.stats().reallocations, 0);
+    for (int i = 0; i < 100; ++i) v.push_back(i);
+    // 1, 2, 4, ..., 128
+    EXPECT_EQ(v.stats().reallocations, 8);
+    EXPECT_EQ(v.stats().bytes_copied, (1 + 2 + 4 + 8 + 16 + 32 + 64) * sizeof(int));
+    EXPECT_EQ(v.stats().peak_capacity, 128);
+
+    v.shrink_to_fit();
+    EXPECT_EQ(v.stats().reallocations, 9);
+    EXPECT_EQ(v.stats().peak_capacity, 128);
+
+    v.reset_stats();
+    EXPECT_EQ(v.stats().reallocations, 0);
+    EXPECT_EQ(v.stats().peak_capacity, 100);
+    v.reserve(100);
+    EXPECT_EQ(v.stats().reallocations, 0);
+
+    decltype(v) copy(v);
+    EXPECT_EQ(copy.stats().reallocations, 0);
+    EXPECT_EQ(copy.stats().peak_capacity, 100);
+    EXPECT_TRUE(copy == v);
+
+    static_assert(sizeof(Vector<int>) == sizeof(Vector<int, 0, std::allocator<int>, growth::OneAndHalf>));
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
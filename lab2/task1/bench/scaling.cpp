@@ -0,0 +1,49 @@
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include "../include/parallel-algorithms.hpp"
+#include "../../../lab1/task5/include/vector.hpp"
+
+using namespace my_container;
+
+namespace {
+
+template <typename F>
+double millis(int rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+}
+
+int main() {
+    const size_t count = size_t(1) << 24;
+    const int rounds = 10;
+    size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    Vector<double> data(count);
+    Vector<double> out(count);
+
+    std::printf("%zu doubles, ms per call\n", count);
+    std::printf("%8s %10s %10s %10s %10s %10s\n", "threads", "fill", "for_each", "transform", "reduce", "scan");
+    // Степени двойки и само число ядер
+    Vector<size_t> counts;
+    for (size_t threads = 1; threads < max_threads; threads *= 2) counts.push_back(threads);
+    counts.push_back(max_threads);
+
+    for (size_t threads : counts) {
+        ThreadPool pool(threads);
+        double fill = millis(rounds, [&] { parallel_fill(pool, data, 1.5); });
+        double for_each = millis(rounds, [&] { parallel_for_each(pool, data, [](double& x) { x = std::sqrt(x + 1.0); }); });
+        double transform = millis(rounds, [&] { parallel_transform(pool, data, out, [](double x) { return x * x + 1.0; }); });
+        volatile double sink = 0;
+        double reduce = millis(rounds, [&] { sink = parallel_reduce(pool, out, 0.0); });
+        double scan = millis(rounds, [&] { parallel_inclusive_scan(pool, data, out); });
+        (void)sink;
+        std::printf("%8zu %10.2f %10.2f %10.2f %10.2f %10.2f\n", threads, fill, for_each, transform, reduce, scan);
+    }
+    return 0;
+}
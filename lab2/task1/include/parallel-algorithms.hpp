@@ -0,0 +1,118 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "thread-pool.hpp"
+
+namespace my_container {
+
+// Любой контейнер с непрерывным хранилищем: Vector, Array, SmallVector
+template <typename C>
+concept ContiguousContainer = requires(C& c) {
+    { c.data() } -> std::convertible_to<const void*>;
+    { c.size() } -> std::convertible_to<size_t>;
+};
+
+namespace detail {
+
+// Разбиение зависит только от размера и grain, но не от числа потоков: reduce и scan над double дают
+// один и тот же результат на пуле любого размера. По умолчанию блоков до default_chunks — по четыре и больше
+// на поток вплоть до 64 потоков, чтобы неровные блоки успевали перераспределиться.
+struct Chunking {
+    static constexpr size_t default_chunks = 256;
+    static constexpr size_t min_grain = 1024;
+
+    size_t size;
+    size_t grain;
+    size_t count;
+
+    Chunking(size_t n, size_t requested_grain) : size(n) {
+        grain = requested_grain ? requested_grain
+                                : std::max<size_t>(min_grain, (n + default_chunks - 1) / default_chunks);
+        count = (n + grain - 1) / grain;
+    }
+
+    size_t begin(size_t chunk) const { return chunk * grain; }
+    size_t end(size_t chunk) const { return std::min(size, (chunk + 1) * grain); }
+};
+
+}  // namespace detail
+
+template <ContiguousContainer C, typename T>
+void parallel_fill(ThreadPool& pool, C& c, const T& value, size_t grain = 0) {
+    auto* data = c.data();
+    detail::Chunking chunks(c.size(), grain);
+    pool.run(chunks.count, [&](size_t k) { std::fill(data + chunks.begin(k), data + chunks.end(k), value); });
+}
+
+template <ContiguousContainer C, typename F>
+void parallel_for_each(ThreadPool& pool, C& c, F f, size_t grain = 0) {
+    auto* data = c.data();
+    detail::Chunking chunks(c.size(), grain);
+    pool.run(chunks.count, [&](size_t k) { std::for_each(data + chunks.begin(k), data + chunks.end(k), f); });
+}
+
+template <ContiguousContainer In, ContiguousContainer Out, typename F>
+void parallel_transform(ThreadPool& pool, const In& in, Out& out, F op, size_t grain = 0) {
+    if (out.size() < in.size()) throw std::length_error("parallel_transform: output is smaller than input");
+    const auto* src = in.data();
+    auto* dst = out.data();
+    detail::Chunking chunks(in.size(), grain);
+    pool.run(chunks.count,
+             [&](size_t k) { std::transform(src + chunks.begin(k), src + chunks.end(k), dst + chunks.begin(k), op); });
+}
+
+// Частичные суммы блоков сворачиваются по порядку: op должна быть ассоциативной, коммутативность не нужна
+template <ContiguousContainer C, typename T, typename Op = std::plus<>>
+T parallel_reduce(ThreadPool& pool, const C& c, T init, Op op = {}, size_t grain = 0) {
+    const auto* data = c.data();
+    detail::Chunking chunks(c.size(), grain);
+    std::vector<std::optional<T>> partial(chunks.count);
+    pool.run(chunks.count, [&](size_t k) {
+        size_t first = chunks.begin(k);
+        size_t last = chunks.end(k);
+        T acc = data[first];
+        for (size_t i = first + 1; i < last; ++i) acc = op(std::move(acc), data[i]);
+        partial[k].emplace(std::move(acc));
+    });
+    for (auto& value : partial) init = op(std::move(init), std::move(*value));
+    return init;
+}
+
+// Два прохода: локальный скан в каждом блоке, затем добавление префикса предыдущих блоков.
+// Допускается in == out.
+template <ContiguousContainer In, ContiguousContainer Out, typename Op = std::plus<>>
+void parallel_inclusive_scan(ThreadPool& pool, const In& in, Out& out, Op op = {}, size_t grain = 0) {
+    if (out.size() < in.size()) throw std::length_error("parallel_inclusive_scan: output is smaller than input");
+    const auto* src = in.data();
+    auto* dst = out.data();
+    detail::Chunking chunks(in.size(), grain);
+
+    pool.run(chunks.count, [&](size_t k) {
+        size_t first = chunks.begin(k);
+        size_t last = chunks.end(k);
+        dst[first] = src[first];
+        for (size_t i = first + 1; i < last; ++i) dst[i] = op(dst[i - 1], src[i]);
+    });
+    if (chunks.count < 2) return;
+
+    using Value = std::remove_cvref_t<decltype(dst[0])>;
+    std::vector<std::optional<Value>> carry(chunks.count);
+    carry[1].emplace(dst[chunks.end(0) - 1]);
+    for (size_t k = 2; k < chunks.count; ++k) {
+        carry[k].emplace(op(*carry[k - 1], dst[chunks.end(k - 1) - 1]));
+    }
+
+    pool.run(chunks.count - 1, [&](size_t j) {
+        size_t k = j + 1;
+        const Value& prefix = *carry[k];
+        for (size_t i = chunks.begin(k); i < chunks.end(k); ++i) dst[i] = op(prefix, dst[i]);
+    });
+}
+
+}  // namespace my_container
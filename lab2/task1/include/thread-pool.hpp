@@ -0,0 +1,142 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace my_container {
+
+// Пул из size() потоков, включая вызывающий: run() раздаёт индексы задач и ждёт завершения всех
+class ThreadPool {
+private:
+    using Invoke = void (*)(void*, size_t);
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::mutex run_mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+
+    void* context_ = nullptr;
+    Invoke invoke_ = nullptr;
+    size_t task_count_ = 0;
+    std::atomic<size_t> next_{0};
+    size_t finished_ = 0;
+    size_t active_ = 0;
+    size_t generation_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+
+    static inline thread_local const ThreadPool* current_ = nullptr;
+
+    size_t drain(void* context, Invoke invoke, size_t count) {
+        size_t done = 0;
+        for (size_t i = next_.fetch_add(1, std::memory_order_relaxed); i < count;
+             i = next_.fetch_add(1, std::memory_order_relaxed)) {
+            try {
+                invoke(context, i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
+            ++done;
+        }
+        return done;
+    }
+
+    void worker_loop() {
+        current_ = this;
+        size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            work_cv_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+            void* context = context_;
+            Invoke invoke = invoke_;
+            size_t count = task_count_;
+            ++active_;
+            lock.unlock();
+
+            size_t done = drain(context, invoke, count);
+
+            lock.lock();
+            finished_ += done;
+            --active_;
+            if (finished_ == task_count_ && active_ == 0) done_cv_.notify_all();
+        }
+    }
+
+public:
+    explicit ThreadPool(size_t threads = std::max(1u, std::thread::hardware_concurrency())) {
+        threads = std::max<size_t>(threads, 1);
+        workers_.reserve(threads - 1);
+        for (size_t i = 1; i < threads; ++i) {
+            workers_.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    size_t size() const noexcept {
+        return workers_.size() + 1;
+    }
+
+    // Вызывает f(i) для каждого i из [0, count); первое исключение пробрасывается вызывающему.
+    // Вложенный run() из задачи этого же пула выполняется последовательно.
+    template <typename F>
+    void run(size_t count, F&& f) {
+        if (count == 0) return;
+        if (workers_.empty() || count == 1 || current_ == this) {
+            for (size_t i = 0; i < count; ++i) f(i);
+            return;
+        }
+
+        using Fn = std::remove_reference_t<F>;
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&] { return active_ == 0; });
+        void* context = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+        Invoke invoke = [](void* ctx, size_t i) { (*static_cast<Fn*>(ctx))(i); };
+        context_ = context;
+        invoke_ = invoke;
+        task_count_ = count;
+        next_.store(0, std::memory_order_relaxed);
+        finished_ = 0;
+        error_ = nullptr;
+        ++generation_;
+        lock.unlock();
+        work_cv_.notify_all();
+
+        const ThreadPool* outer = current_;
+        current_ = this;
+        size_t done = drain(context, invoke, count);
+        current_ = outer;
+
+        lock.lock();
+        finished_ += done;
+        done_cv_.wait(lock, [&] { return finished_ == task_count_ && active_ == 0; });
+        std::exception_ptr error = std::exchange(error_, nullptr);
+        lock.unlock();
+        if (error) std::rethrow_exception(error);
+    }
+};
+
+}  // namespace my_container
@@ -0,0 +1,19 @@
+#include <iostream>
+#include "../include/parallel-algorithms.hpp"
+#include "../../../lab1/task5/include/vector.hpp"
+
+using namespace my_container;
+
+int main() {
+    ThreadPool pool;
+    Vector<long long> v(1000000);
+
+    parallel_fill(pool, v, 1LL);
+    parallel_inclusive_scan(pool, v, v);
+    parallel_for_each(pool, v, [](long long& x) { x *= 2; });
+
+    std::cout << "Потоков: " << pool.size() << std::endl;
+    std::cout << "Последний элемент: " << v.back() << std::endl;
+    std::cout << "Сумма: " << parallel_reduce(pool, v, 0LL) << std::endl;
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include "../include/parallel-algorithms.hpp"
+#include "../../../lab1/task1/include/array.hpp"
+#include "../../../lab1/task5/include/vector.hpp"
+
+using namespace my_container;
+
+TEST(ThreadPoolTest, RunsEveryIndexOnce) {
+    for (size_t threads : {1, 2, 4}) {
+        ThreadPool pool(threads);
+        EXPECT_EQ(pool.size(), threads);
+        std::vector<std::atomic<int>> hits(1000);
+        for (int round = 0; round < 10; ++round) {
+            pool.run(hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+        }
+        for (auto& h : hits) EXPECT_EQ(h.load(), 10);
+    }
+}
+
+TEST(ThreadPoolTest, PropagatesException) {
+    ThreadPool pool(3);
+    EXPECT_THROW(pool.run(100,
+                          [](size_t i) {
+                              if (i == 42) throw std::runtime_error("task failed");
+                          }),
+                 std::runtime_error);
+
+    std::atomic<size_t> count{0};
+    pool.run(10, [&](size_t) { count.fetch_add(1); });
+    EXPECT_EQ(count.load(), 10u);
+}
+
+TEST(ThreadPoolTest, NestedRunIsSequential) {
+    ThreadPool pool(2);
+    std::atomic<size_t> count{0};
+    pool.run(4, [&](size_t) { pool.run(5, [&](size_t) { count.fetch_add(1); }); });
+    EXPECT_EQ(count.load(), 20u);
+}
+
+TEST(ParallelAlgorithmsTest, FillAndForEach) {
+    ThreadPool pool(4);
+    Vector<int> v(10000);
+    parallel_fill(pool, v, 3, 100);
+    parallel_for_each(pool, v, [](int& x) { x += 1; }, 333);
+    for (size_t i = 0; i < v.size(); ++i) ASSERT_EQ(v[i], 4);
+
+    Array<double, 257> a;
+    parallel_fill(pool, a, 0.5, 16);
+    EXPECT_EQ(a[0], 0.5);
+    EXPECT_EQ(a[256], 0.5);
+}
+
+TEST(ParallelAlgorithmsTest, Transform) {
+    ThreadPool pool(3);
+    Vector<int> in(5000);
+    for (size_t i = 0; i < in.size(); ++i) in[i] = static_cast<int>(i);
+    Vector<long long> out(5000);
+    parallel_transform(pool, in, out, [](int x) { return static_cast<long long>(x) * x; }, 64);
+    EXPECT_EQ(out[4999], 4999LL * 4999);
+
+    Vector<long long> small(10);
+    EXPECT_THROW(parallel_transform(pool, in, small, [](int x) { return x; }), std::length_error);
+}
+
+TEST(ParallelAlgorithmsTest, ReduceMatchesSequential) {
+    ThreadPool pool(4);
+    Vector<long long> v(100001);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<long long>(i);
+    EXPECT_EQ(parallel_reduce(pool, v, 0LL), std::accumulate(v.begin(), v.end(), 0LL));
+    EXPECT_EQ(parallel_reduce(pool, v, 10LL, std::plus<>{}, 7), std::accumulate(v.begin(), v.end(), 10LL));
+
+    Vector<int> empty;
+    EXPECT_EQ(parallel_reduce(pool, empty, 5), 5);
+
+    Vector<std::string> words = {"a", "b", "c", "d", "e"};
+    EXPECT_EQ(parallel_reduce(pool, words, std::string(">"), std::plus<>{}, 2), ">abcde");
+}
+
+TEST(ParallelAlgorithmsTest, ReduceDeterministicForSameThreadCount) {
+    Vector<double> v(50000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = 1.0 / static_cast<double>(i + 1);
+    ThreadPool pool(4);
+    double first = parallel_reduce(pool, v, 0.0);
+    for (int i = 0; i < 20; ++i) EXPECT_EQ(parallel_reduce(pool, v, 0.0), first);
+}
+
+TEST(ParallelAlgorithmsTest, ReduceAndScanIgnoreThreadCount) {
+    // Разбиение по умолчанию не зависит от размера пула, поэтому и сумма double побитово та же
+    Vector<double> v(200000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = 1.0 / static_cast<double>(i + 1);
+    ThreadPool single(1);
+    double sum = parallel_reduce(single, v, 0.0);
+    Vector<double> scan(v.size());
+    parallel_inclusive_scan(single, v, scan);
+
+    for (size_t threads : {2, 3, 4, 7}) {
+        ThreadPool pool(threads);
+        EXPECT_EQ(parallel_reduce(pool, v, 0.0), sum);
+        Vector<double> out(v.size());
+        parallel_inclusive_scan(pool, v, out);
+        EXPECT_TRUE(out == scan);
+    }
+}
+
+TEST(ParallelAlgorithmsTest, InclusiveScan) {
+    ThreadPool pool(4);
+    Vector<long long> v(10007);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<long long>(i % 13);
+    Vector<long long> expected(v.size());
+    std::inclusive_scan(v.begin(), v.end(), expected.begin());
+
+    Vector<long long> out(v.size());
+    parallel_inclusive_scan(pool, v, out, std::plus<>{}, 100);
+    EXPECT_TRUE(out == expected);
+
+    parallel_inclusive_scan(pool, v, v);
+    EXPECT_TRUE(v == expected);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../include/spsc-queue.hpp"
+#include "../../../lab1/task3/include/deque.hpp"
+
+using namespace my_container;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t capacity = 1024;
+constexpr size_t batch = 64;
+
+// Для сравнения: тот же ограниченный буфер на Deque под мьютексом
+class LockedQueue {
+private:
+    std::mutex mutex_;
+    Deque<long long> items_;
+
+public:
+    bool try_push(long long value) {
+        std::lock_guard lock(mutex_);
+        if (items_.size() == capacity) return false;
+        items_.push_back(value);
+        return true;
+    }
+
+    bool try_pop(long long& out) {
+        std::lock_guard lock(mutex_);
+        if (items_.empty()) return false;
+        out = items_.front();
+        items_.pop_front();
+        return true;
+    }
+};
+
+// Миллионы элементов в секунду; push и pop — по одному элементу или пачкой
+template <typename Push, typename Pop>
+double throughput(size_t count, Push push, Pop pop) {
+    auto start = Clock::now();
+    std::thread producer([&] {
+        for (size_t sent = 0; sent < count;) {
+            size_t n = push(sent);
+            if (n == 0) std::this_thread::yield();
+            sent += n;
+        }
+    });
+    long long sum = 0;
+    for (size_t received = 0; received < count;) {
+        size_t n = pop(sum);
+        if (n == 0) std::this_thread::yield();
+        received += n;
+    }
+    producer.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (sum != static_cast<long long>(count) * static_cast<long long>(count - 1) / 2) std::printf("checksum mismatch\n");
+    return static_cast<double>(count) / seconds / 1e6;
+}
+
+// Полный оборот туда и обратно через две очереди, нс: медиана и 99-й перцентиль.
+// Ожидание уступает ядро: на одном ядре чистый спин съедал бы весь квант планировщика
+void ping_pong(size_t rounds) {
+    SpscQueue<long long> there(capacity);
+    SpscQueue<long long> back(capacity);
+    std::thread echo([&] {
+        long long value = 0;
+        for (size_t i = 0; i < rounds; ++i) {
+            while (!there.try_pop(value)) std::this_thread::yield();
+            while (!back.try_push(value)) std::this_thread::yield();
+        }
+    });
+
+    std::vector<double> samples(rounds);
+    long long value = 0;
+    for (size_t i = 0; i < rounds; ++i) {
+        auto start = Clock::now();
+        while (!there.try_push(static_cast<long long>(i))) std::this_thread::yield();
+        while (!back.try_pop(value)) std::this_thread::yield();
+        samples[i] = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+    echo.join();
+
+    std::sort(samples.begin(), samples.end());
+    std::printf("ping-pong round trip: median %.0f ns, p99 %.0f ns\n", samples[rounds / 2], samples[rounds * 99 / 100]);
+}
+
+}  // namespace
+
+int main() {
+    const size_t count = 20'000'000;
+    std::printf("%zu long longs, capacity %zu, Mops/s\n", count, capacity);
+
+    {
+        SpscQueue<long long> queue(capacity);
+        double single = throughput(
+            count, [&](size_t next) -> size_t { return queue.try_push(static_cast<long long>(next)) ? 1 : 0; },
+            [&](long long& sum) -> size_t {
+                long long value = 0;
+                if (!queue.try_pop(value)) return 0;
+                sum += value;
+                return 1;
+            });
+        std::printf("%-22s %10.1f\n", "spsc try_push/try_pop", single);
+    }
+    {
+        SpscQueue<long long> queue(capacity);
+        std::vector<long long> in(batch);
+        std::vector<long long> out(batch);
+        double batched = throughput(
+            count,
+            [&](size_t next) {
+                size_t n = std::min(batch, count - next);
+                for (size_t i = 0; i < n; ++i) in[i] = static_cast<long long>(next + i);
+                return queue.push_n(in.begin(), n);
+            },
+            [&](long long& sum) {
+                size_t n = queue.pop_n(out.begin(), batch);
+                for (size_t i = 0; i < n; ++i) sum += out[i];
+                return n;
+            });
+        std::printf("%-22s %10.1f\n", "spsc push_n/pop_n", batched);
+    }
+    {
+        LockedQueue queue;
+        double locked = throughput(
+            count / 4, [&](size_t next) -> size_t { return queue.try_push(static_cast<long long>(next)) ? 1 : 0; },
+            [&](long long& sum) -> size_t {
+                long long value = 0;
+                if (!queue.try_pop(value)) return 0;
+                sum += value;
+                return 1;
+            });
+        std::printf("%-22s %10.1f\n", "mutex + Deque", locked);
+    }
+
+    ping_pong(200'000);
+    return 0;
+}
@@ -0,0 +1,166 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace my_container {
+
+// std::hardware_destructive_interference_size в GCC зависит от флагов -mtune, поэтому берём типичную строку
+inline constexpr size_t spsc_cache_line = 64;
+
+// Ограниченная очередь без блокировок для ровно одного производителя и одного потребителя.
+// head_ пишет только потребитель, tail_ — только производитель; каждый держит ещё и кэшированную копию чужого
+// индекса на своей строке кэша и перечитывает настоящий индекс, лишь когда копия говорит «полно» или «пусто».
+// Индексы растут монотонно, ячейка — индекс & mask_. Публикация идёт release-записью индекса после того, как
+// элемент построен (или разрушен), а другая сторона читает индекс с acquire, поэтому видит элемент целиком.
+// Вызывать try_push/push_n одновременно из двух потоков, как и try_pop/pop_n, нельзя.
+template <typename T, typename Alloc = std::allocator<T>>
+class SpscQueue {
+private:
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    // Строка потребителя
+    alignas(spsc_cache_line) std::atomic<size_t> head_{0};
+    size_t cached_tail_ = 0;
+
+    // Строка производителя
+    alignas(spsc_cache_line) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+
+    // Только для чтения после конструктора
+    alignas(spsc_cache_line) T* buffer_ = nullptr;
+    size_t mask_ = 0;
+    [[no_unique_address]] Alloc alloc_;
+
+    T* slot(size_t index) const noexcept {
+        return buffer_ + (index & mask_);
+    }
+
+    // Сколько ячеек производитель может занять, не глядя на head_ заново
+    size_t free_slots(size_t tail) const noexcept {
+        return capacity() - (tail - cached_head_);
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    // Ёмкость округляется вверх до степени двойки
+    explicit SpscQueue(size_t capacity, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+        if (capacity == 0) throw std::invalid_argument("SpscQueue capacity must be positive");
+        capacity = std::bit_ceil(capacity);
+        buffer_ = AllocTraits::allocate(alloc_, capacity);
+        mask_ = capacity - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    ~SpscQueue() {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        for (; head != tail; ++head) std::destroy_at(slot(head));
+        AllocTraits::deallocate(alloc_, buffer_, capacity());
+    }
+
+    size_t capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+    // Точно только из потока производителя или потребителя в отсутствие другого; иначе — снимок.
+    // head_ читается первым: tail_ не меньше любого уже опубликованного head_, так что разность не уходит в минус.
+    // Но между двумя чтениями стороны успевают сделать ещё k операций, и разность доходит до capacity() + k,
+    // поэтому стороннему наблюдателю она обрезается по ёмкости
+    size_t size_approx() const noexcept {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        return std::min(tail - head, capacity());
+    }
+
+    bool empty_approx() const noexcept {
+        return size_approx() == 0;
+    }
+
+    // Производитель. false — очередь полна, элемент не построен
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (free_slots(tail) == 0) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (free_slots(tail) == 0) return false;
+        }
+        std::construct_at(slot(tail), std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value) {
+        return try_emplace(value);
+    }
+
+    bool try_push(T&& value) {
+        return try_emplace(std::move(value));
+    }
+
+    // Производитель. Кладёт сколько поместится из count элементов и публикует их одной записью tail_;
+    // возвращает, сколько положено. Если конструктор бросит, не опубликовано ничего из этой пачки.
+    template <std::input_iterator InputIt>
+    size_t push_n(InputIt first, size_t count) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (free_slots(tail) < count) cached_head_ = head_.load(std::memory_order_acquire);
+        size_t n = std::min(count, free_slots(tail));
+        size_t built = 0;
+        try {
+            for (; built < n; ++built, ++first) std::construct_at(slot(tail + built), *first);
+        } catch (...) {
+            while (built > 0) std::destroy_at(slot(tail + --built));
+            throw;
+        }
+        if (n) tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    // Потребитель. false — очередь пуста, out не тронут
+    bool try_pop(T& out) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) return false;
+        }
+        T* item = slot(head);
+        out = std::move(*item);
+        std::destroy_at(item);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Потребитель. Забирает до max_count элементов в out и освобождает ячейки одной записью head_.
+    // Если присваивание в out бросит, уже забранные элементы останутся забранными.
+    template <std::output_iterator<T&&> OutputIt>
+    size_t pop_n(OutputIt out, size_t max_count) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (cached_tail_ - head < max_count) cached_tail_ = tail_.load(std::memory_order_acquire);
+        size_t n = std::min(max_count, cached_tail_ - head);
+        size_t taken = 0;
+        try {
+            for (; taken < n; ++taken) {
+                T* item = slot(head + taken);
+                *out = std::move(*item);
+                ++out;
+                std::destroy_at(item);
+            }
+        } catch (...) {
+            head_.store(head + taken, std::memory_order_release);
+            throw;
+        }
+        if (n) head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+};
+
+}  // namespace my_container
@@ -0,0 +1,36 @@
+#include <iostream>
+#include <thread>
+#include "../include/spsc-queue.hpp"
+
+using namespace my_container;
+
+int main() {
+    SpscQueue<long long> queue(1024);
+    constexpr long long count = 1000000;
+
+    std::thread producer([&] {
+        for (long long i = 1; i <= count;) {
+            if (queue.try_push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    long long sum = 0;
+    long long value = 0;
+    for (long long received = 0; received < count;) {
+        if (queue.try_pop(value)) {
+            sum += value;
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    std::cout << "Ёмкость: " << queue.capacity() << std::endl;
+    std::cout << "Сумма: " << sum << std::endl;
+    return 0;
+}
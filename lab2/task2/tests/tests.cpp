@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/spsc-queue.hpp"
+
+using namespace my_container;
+
+namespace {
+
+struct Counted {
+    static inline int live = 0;
+    static inline int copies_left = -1;
+    int value = 0;
+
+    explicit Counted(int v = 0) : value(v) { ++live; }
+    Counted(const Counted& other) : value(other.value) {
+        if (copies_left == 0) throw std::runtime_error("copy failed");
+        if (copies_left > 0) --copies_left;
+        ++live;
+    }
+    Counted& operator=(const Counted&) = default;
+    ~Counted() { --live; }
+};
+
+}  // namespace
+
+TEST(SpscQueueTest, SingleThreadFifo) {
+    SpscQueue<int> queue(5);
+    EXPECT_EQ(queue.capacity(), 8);
+    EXPECT_THROW(SpscQueue<int>(0), std::invalid_argument);
+
+    int out = -1;
+    EXPECT_FALSE(queue.try_pop(out));
+    EXPECT_EQ(out, -1);
+
+    // Несколько оборотов кольца
+    int next_in = 0;
+    int next_out = 0;
+    for (int round = 0; round < 10; ++round) {
+        while (queue.try_push(next_in)) ++next_in;
+        EXPECT_EQ(queue.size_approx(), 8);
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_TRUE(queue.try_pop(out));
+            EXPECT_EQ(out, next_out++);
+        }
+    }
+    while (queue.try_pop(out)) EXPECT_EQ(out, next_out++);
+    EXPECT_EQ(next_out, next_in);
+    EXPECT_TRUE(queue.empty_approx());
+}
+
+TEST(SpscQueueTest, BatchPushAndPop) {
+    SpscQueue<std::string> queue(8);
+    std::vector<std::string> input;
+    for (int i = 0; i < 12; ++i) input.push_back(std::to_string(i));
+
+    EXPECT_EQ(queue.push_n(input.begin(), input.size()), 8);
+    EXPECT_EQ(queue.push_n(input.begin() + 8, 4), 0);
+
+    std::vector<std::string> output;
+    EXPECT_EQ(queue.pop_n(std::back_inserter(output), 3), 3);
+    EXPECT_EQ(queue.push_n(input.begin() + 8, 4), 3);
+    EXPECT_EQ(queue.pop_n(std::back_inserter(output), 100), 8);
+    EXPECT_EQ(queue.pop_n(std::back_inserter(output), 100), 0);
+    EXPECT_EQ(output, std::vector<std::string>(input.begin(), input.begin() + 11));
+}
+
+TEST(SpscQueueTest, DestroysLeftoversAndRollsBackFailedBatch) {
+    {
+        SpscQueue<Counted> queue(4);
+        queue.try_emplace(1);
+        queue.try_push(Counted(2));
+        EXPECT_EQ(Counted::live, 2);
+
+        std::vector<Counted> batch(3, Counted(7));
+        Counted::copies_left = 1;
+        EXPECT_THROW(queue.push_n(batch.begin(), batch.size()), std::runtime_error);
+        Counted::copies_left = -1;
+        EXPECT_EQ(queue.size_approx(), 2);
+        EXPECT_EQ(Counted::live, 5);
+
+        Counted out;
+        ASSERT_TRUE(queue.try_pop(out));
+        EXPECT_EQ(out.value, 1);
+    }
+    EXPECT_EQ(Counted::live, 0);
+}
+
+TEST(SpscQueueTest, TwoThreadsKeepOrder) {
+    constexpr int count = 200000;
+    SpscQueue<std::unique_ptr<int>> queue(64);
+    std::atomic<bool> failed{false};
+
+    std::thread producer([&] {
+        int next = 0;
+        std::vector<std::unique_ptr<int>> batch;
+        while (next < count) {
+            if (next % 3 == 0) {
+                batch.clear();
+                for (int i = next; i < std::min(next + 16, count); ++i) batch.push_back(std::make_unique<int>(i));
+                size_t pushed = queue.push_n(std::make_move_iterator(batch.begin()), batch.size());
+                next += static_cast<int>(pushed);
+                if (pushed == 0) std::this_thread::yield();
+            } else {
+                if (queue.try_push(std::make_unique<int>(next))) {
+                    ++next;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    });
+
+    // Сторонний наблюдатель: без обрезки по ёмкости снимок размера на нескольких ядрах выходил бы за capacity()
+    std::atomic<bool> finished{false};
+    std::atomic<bool> bad_size{false};
+    std::thread observer([&] {
+        while (!finished.load(std::memory_order_relaxed)) {
+            if (queue.size_approx() > queue.capacity()) bad_size = true;
+            std::this_thread::yield();
+        }
+    });
+
+    int expected = 0;
+    std::vector<std::unique_ptr<int>> received;
+    while (expected < count) {
+        received.clear();
+        if (expected % 2 == 0) {
+            queue.pop_n(std::back_inserter(received), 10);
+        } else {
+            std::unique_ptr<int> item;
+            if (queue.try_pop(item)) received.push_back(std::move(item));
+        }
+        if (received.empty()) std::this_thread::yield();
+        for (const auto& item : received) {
+            if (!item || *item != expected) failed = true;
+            ++expected;
+        }
+    }
+    producer.join();
+    finished = true;
+    observer.join();
+    EXPECT_FALSE(failed.load());
+    EXPECT_FALSE(bad_size.load());
+    EXPECT_TRUE(queue.empty_approx());
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,77 @@
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <thread>
+#include "../include/task-scheduler.hpp"
+#include "../../../lab1/task5/include/vector.hpp"
+
+using namespace my_container;
+
+namespace {
+
+constexpr int fib_cutoff = 20;
+constexpr size_t sum_grain = 1 << 14;
+
+template <typename F>
+double millis(int rounds, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+long long fib_seq(int n) {
+    return n < 2 ? n : fib_seq(n - 1) + fib_seq(n - 2);
+}
+
+long long fib(TaskScheduler& scheduler, int n) {
+    if (n < fib_cutoff) return fib_seq(n);
+    long long a = 0;
+    long long b = 0;
+    parallel_invoke(scheduler, [&] { a = fib(scheduler, n - 1); }, [&] { b = fib(scheduler, n - 2); });
+    return a + b;
+}
+
+double sum(TaskScheduler& scheduler, const double* first, const double* last) {
+    if (static_cast<size_t>(last - first) <= sum_grain) return std::accumulate(first, last, 0.0);
+    const double* middle = first + (last - first) / 2;
+    double left = 0;
+    double right = 0;
+    parallel_invoke(scheduler, [&] { left = sum(scheduler, first, middle); },
+                    [&] { right = sum(scheduler, middle, last); });
+    return left + right;
+}
+
+}  // namespace
+
+int main() {
+    const int n = 34;
+    const size_t count = size_t(1) << 24;
+    const int rounds = 5;
+    size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    Vector<double> data(count);
+    std::fill(data.begin(), data.end(), 0.5);
+    volatile long long fib_sink = 0;
+    volatile double sum_sink = 0;
+
+    std::printf("fib(%d), cutoff %d; sum of %zu doubles, grain %zu; ms per call\n", n, fib_cutoff, count, sum_grain);
+    std::printf("%8s %10s %10s\n", "threads", "fib", "sum");
+    std::printf("%8s %10.2f %10.2f\n", "seq", millis(rounds, [&] { fib_sink = fib_seq(n); }),
+                millis(rounds, [&] { sum_sink = std::accumulate(data.begin(), data.end(), 0.0); }));
+
+    // Степени двойки и само число ядер
+    Vector<size_t> counts;
+    for (size_t threads = 1; threads < max_threads; threads *= 2) counts.push_back(threads);
+    counts.push_back(max_threads);
+
+    for (size_t threads : counts) {
+        TaskScheduler scheduler(threads);
+        double fib_ms = millis(rounds, [&] { fib_sink = fib(scheduler, n); });
+        double sum_ms = millis(rounds, [&] { sum_sink = sum(scheduler, data.data(), data.data() + data.size()); });
+        std::printf("%8zu %10.2f %10.2f\n", threads, fib_ms, sum_ms);
+    }
+    (void)fib_sink;
+    (void)sum_sink;
+    return 0;
+}
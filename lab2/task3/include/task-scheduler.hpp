@@ -0,0 +1,275 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "work-stealing-deque.hpp"
+
+namespace my_container {
+
+class TaskScheduler;
+class TaskGroup;
+
+namespace detail {
+
+// Задача в куче; invoke выполняет её и освобождает память, даже если f бросила
+struct Task {
+    using Invoke = void (*)(Task*);
+
+    Invoke invoke;
+    TaskGroup* group;
+};
+
+template <typename F>
+struct TaskFor : Task {
+    F f;
+
+    template <typename G>
+    TaskFor(TaskGroup* owner, G&& g) : Task{&run, owner}, f(std::forward<G>(g)) {}
+
+    static void run(Task* task) {
+        std::unique_ptr<TaskFor> self(static_cast<TaskFor*>(task));
+        self->f();
+    }
+};
+
+}  // namespace detail
+
+// Набор задач fork/join: spawn() кладёт задачу в дек текущего рабочего потока, wait() ждёт все задачи группы,
+// выполняя тем временем любую доступную работу, и пробрасывает первое исключение. Деструктор тоже ждёт.
+// Пользоваться группой можно только из потоков планировщика, то есть внутри TaskScheduler::run().
+class TaskGroup {
+private:
+    friend class TaskScheduler;
+
+    TaskScheduler& scheduler_;
+    std::atomic<size_t> pending_{0};
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+
+    void fail(std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) error_ = std::move(error);
+    }
+
+public:
+    explicit TaskGroup(TaskScheduler& scheduler) noexcept : scheduler_(scheduler) {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup();
+
+    template <typename F>
+    void spawn(F&& f);
+
+    void wait();
+};
+
+// Планировщик с кражей работы: у каждого потока свой WorkStealingDeque. Поток берёт задачи со своего дна,
+// а без работы крадёт с вершины чужого дека, начиная со случайной жертвы; долго не найдя работы, засыпает.
+// Потоков size(), и нулевой из них — тот, кто вызвал run(), как в ThreadPool.
+class TaskScheduler {
+private:
+    friend class TaskGroup;
+
+    struct Worker {
+        TaskScheduler* owner;
+        WorkStealingDeque<detail::Task*> deque;
+        std::uint64_t seed;
+
+        Worker(TaskScheduler* scheduler, std::uint64_t seed_value) : owner(scheduler), seed(seed_value) {}
+    };
+
+    // Сколько раз подряд поток ищет работу, уступая ядро, прежде чем уснуть
+    static constexpr size_t spin_rounds = 64;
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::mutex run_mutex_;
+    std::condition_variable wake_cv_;
+    std::atomic<size_t> sleeping_{0};
+    bool stop_ = false;
+
+    static inline thread_local Worker* current_ = nullptr;
+
+    Worker* local() const noexcept {
+        return current_ && current_->owner == this ? current_ : nullptr;
+    }
+
+    void push(Worker& self, detail::Task* task) {
+        self.deque.push(task);
+        // Пара к ограде в worker_loop: либо спящий увидит задачу, либо мы увидим спящего
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            wake_cv_.notify_one();
+        }
+    }
+
+    detail::Task* find_work(Worker& self) {
+        if (auto task = self.deque.pop()) return *task;
+
+        // xorshift64: жертвы выбираются вразнобой, чтобы воры не толпились у одного дека
+        self.seed ^= self.seed << 13;
+        self.seed ^= self.seed >> 7;
+        self.seed ^= self.seed << 17;
+        size_t count = workers_.size();
+        size_t start = static_cast<size_t>(self.seed % count);
+        for (size_t k = 0; k < count; ++k) {
+            Worker& victim = *workers_[(start + k) % count];
+            if (&victim == &self) continue;
+            if (auto task = victim.deque.steal()) return *task;
+        }
+        return nullptr;
+    }
+
+    bool has_work() const noexcept {
+        return std::any_of(workers_.begin(), workers_.end(),
+                           [](const auto& worker) { return !worker->deque.empty_approx(); });
+    }
+
+    static void execute(detail::Task* task) {
+        TaskGroup* group = task->group;
+        try {
+            task->invoke(task);
+        } catch (...) {
+            group->fail(std::current_exception());
+        }
+        // После этой записи группа может быть уже разрушена
+        group->pending_.fetch_sub(1, std::memory_order_release);
+    }
+
+    void worker_loop(Worker& self) {
+        current_ = &self;
+        size_t idle = 0;
+        while (true) {
+            if (detail::Task* task = find_work(self)) {
+                execute(task);
+                idle = 0;
+                continue;
+            }
+            if (++idle < spin_rounds) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (stop_) return;
+            sleeping_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!has_work()) wake_cv_.wait(lock);
+            sleeping_.fetch_sub(1, std::memory_order_relaxed);
+            if (stop_) return;
+            idle = 0;
+        }
+    }
+
+public:
+    explicit TaskScheduler(size_t threads = std::max(1u, std::thread::hardware_concurrency())) {
+        threads = std::max<size_t>(threads, 1);
+        workers_.reserve(threads);
+        for (size_t i = 0; i < threads; ++i) {
+            workers_.push_back(std::make_unique<Worker>(this, 0x9E3779B97F4A7C15ULL * (i + 1)));
+        }
+        threads_.reserve(threads - 1);
+        for (size_t i = 1; i < threads; ++i) {
+            threads_.emplace_back([this, i] { worker_loop(*workers_[i]); });
+        }
+    }
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    ~TaskScheduler() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_cv_.notify_all();
+        for (auto& thread : threads_) thread.join();
+    }
+
+    size_t size() const noexcept {
+        return workers_.size();
+    }
+
+    // Выполняет f() в вызывающем потоке, сделав его нулевым рабочим, и возвращает результат.
+    // Внешние вызовы run() выполняются по очереди; вложенный run() из задачи просто вызывает f().
+    template <typename F>
+    std::invoke_result_t<F&> run(F&& f) {
+        if (local()) return f();
+
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+        struct Restore {
+            Worker* outer;
+            ~Restore() { current_ = outer; }
+        } restore{std::exchange(current_, workers_[0].get())};
+        return f();
+    }
+};
+
+inline TaskGroup::~TaskGroup() {
+    try {
+        wait();
+    } catch (...) {
+    }
+}
+
+template <typename F>
+void TaskGroup::spawn(F&& f) {
+    TaskScheduler::Worker* self = scheduler_.local();
+    if (!self) throw std::logic_error("TaskGroup::spawn called outside TaskScheduler::run");
+
+    auto task = std::make_unique<detail::TaskFor<std::decay_t<F>>>(this, std::forward<F>(f));
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    try {
+        scheduler_.push(*self, task.get());
+    } catch (...) {
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+    task.release();
+}
+
+inline void TaskGroup::wait() {
+    TaskScheduler::Worker* self = scheduler_.local();
+    while (pending_.load(std::memory_order_acquire) != 0) {
+        detail::Task* task = self ? scheduler_.find_work(*self) : nullptr;
+        if (task) {
+            TaskScheduler::execute(task);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        error = std::exchange(error_, nullptr);
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+// a() выполняется сразу, b() — задачей, которую может украсть другой поток
+template <typename A, typename B>
+void parallel_invoke(TaskScheduler& scheduler, A&& a, B&& b) {
+    scheduler.run([&] {
+        TaskGroup group(scheduler);
+        group.spawn(std::forward<B>(b));
+        a();
+        group.wait();
+    });
+}
+
+}  // namespace my_container
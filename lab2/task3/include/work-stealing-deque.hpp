@@ -0,0 +1,134 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace my_container {
+
+inline constexpr size_t steal_cache_line = 64;
+
+// Дек Чейза–Лева: владелец кладёт и забирает снизу (LIFO), воры из других потоков крадут сверху (FIFO).
+// Индексы растут монотонно, ячейка — индекс & mask. Когда кольцо заполнено, владелец переносит элементы
+// в кольцо вдвое больше; старое не освобождается до разрушения дека, потому что вор мог успеть взять
+// на него указатель. Порядки памяти — по Lê, Pop, Cohen, Zappa Nardelli (PPoPP 2013).
+// push/pop можно вызывать только из одного потока-владельца, steal — из любого.
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque stores elements in std::atomic<T>");
+
+private:
+    struct Ring {
+        size_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Ring(size_t capacity) : mask(capacity - 1), slots(std::make_unique<std::atomic<T>[]>(capacity)) {}
+
+        size_t capacity() const noexcept { return mask + 1; }
+
+        T load(std::int64_t index) const noexcept {
+            return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+
+        void store(std::int64_t index, T value) noexcept {
+            slots[static_cast<size_t>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(steal_cache_line) std::atomic<std::int64_t> top_{0};
+    alignas(steal_cache_line) std::atomic<std::int64_t> bottom_{0};
+    std::atomic<Ring*> ring_{nullptr};
+    // Все поколения колец; трогает только владелец
+    std::vector<std::unique_ptr<Ring>> rings_;
+
+    Ring* grow(Ring* old, std::int64_t top, std::int64_t bottom) {
+        auto bigger = std::make_unique<Ring>(old->capacity() * 2);
+        for (std::int64_t i = top; i < bottom; ++i) bigger->store(i, old->load(i));
+        Ring* ring = bigger.get();
+        rings_.push_back(std::move(bigger));
+        ring_.store(ring, std::memory_order_release);
+        return ring;
+    }
+
+public:
+    using value_type = T;
+
+    // Начальная ёмкость округляется вверх до степени двойки
+    explicit WorkStealingDeque(size_t capacity = 64) {
+        if (capacity == 0) throw std::invalid_argument("WorkStealingDeque capacity must be positive");
+        rings_.push_back(std::make_unique<Ring>(std::bit_ceil(capacity)));
+        ring_.store(rings_.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    size_t capacity() const noexcept {
+        return ring_.load(std::memory_order_acquire)->capacity();
+    }
+
+    // Снимок: пока работают воры, может устареть сразу после возврата
+    size_t size_approx() const noexcept {
+        std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    bool empty_approx() const noexcept {
+        return size_approx() == 0;
+    }
+
+    // Владелец
+    void push(T value) {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+        if (bottom - top >= static_cast<std::int64_t>(ring->capacity())) ring = grow(ring, top, bottom);
+        ring->store(bottom, value);
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    // Владелец. Пусто — nullopt; за последний элемент соревнуется с ворами через CAS по top_
+    std::optional<T> pop() {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_release);
+            return std::nullopt;
+        }
+        T value = ring->load(bottom);
+        if (top == bottom) {
+            bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_release);
+            if (!won) return std::nullopt;
+        }
+        return value;
+    }
+
+    // Любой поток. nullopt — дек пуст или элемент перехватил другой вор либо владелец
+    std::optional<T> steal() {
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) return std::nullopt;
+
+        Ring* ring = ring_.load(std::memory_order_acquire);
+        T value = ring->load(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+        return value;
+    }
+};
+
+}  // namespace my_container
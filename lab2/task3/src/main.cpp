@@ -0,0 +1,23 @@
+#include <iostream>
+#include "../include/task-scheduler.hpp"
+
+using namespace my_container;
+
+namespace {
+
+long long fib(TaskScheduler& scheduler, int n) {
+    if (n < 20) return n < 2 ? n : fib(scheduler, n - 1) + fib(scheduler, n - 2);
+    long long a = 0;
+    long long b = 0;
+    parallel_invoke(scheduler, [&] { a = fib(scheduler, n - 1); }, [&] { b = fib(scheduler, n - 2); });
+    return a + b;
+}
+
+}  // namespace
+
+int main() {
+    TaskScheduler scheduler;
+    std::cout << "Потоков: " << scheduler.size() << std::endl;
+    std::cout << "fib(35) = " << fib(scheduler, 35) << std::endl;
+    return 0;
+}
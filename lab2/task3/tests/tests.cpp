@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "../include/task-scheduler.hpp"
+#include "../../../lab1/task5/include/vector.hpp"
+
+using namespace my_container;
+
+namespace {
+
+long long fib(TaskScheduler& scheduler, int n) {
+    if (n < 12) return n < 2 ? n : fib(scheduler, n - 1) + fib(scheduler, n - 2);
+    long long a = 0;
+    long long b = 0;
+    parallel_invoke(scheduler, [&] { a = fib(scheduler, n - 1); }, [&] { b = fib(scheduler, n - 2); });
+    return a + b;
+}
+
+long long sum(TaskScheduler& scheduler, const long long* first, const long long* last) {
+    if (last - first <= 1000) return std::accumulate(first, last, 0LL);
+    const long long* middle = first + (last - first) / 2;
+    long long left = 0;
+    long long right = 0;
+    parallel_invoke(scheduler, [&] { left = sum(scheduler, first, middle); },
+                    [&] { right = sum(scheduler, middle, last); });
+    return left + right;
+}
+
+}  // namespace
+
+TEST(WorkStealingDequeTest, OwnerLifoThiefFifoAndGrowth) {
+    WorkStealingDeque<int> deque(3);
+    EXPECT_EQ(deque.capacity(), 4);
+    EXPECT_FALSE(deque.pop());
+    EXPECT_FALSE(deque.steal());
+    EXPECT_THROW(WorkStealingDeque<int>(0), std::invalid_argument);
+
+    for (int i = 0; i < 100; ++i) deque.push(i);
+    EXPECT_EQ(deque.size_approx(), 100);
+    EXPECT_EQ(deque.capacity(), 128);
+
+    EXPECT_EQ(deque.steal(), 0);
+    EXPECT_EQ(deque.steal(), 1);
+    EXPECT_EQ(deque.pop(), 99);
+    EXPECT_EQ(deque.pop(), 98);
+
+    // Индексы уходят вперёд, кольцо переиспользуется по кругу
+    for (int round = 0; round < 1000; ++round) {
+        deque.push(round);
+        EXPECT_EQ(deque.steal(), round < 96 ? round + 2 : round - 96);
+    }
+    EXPECT_EQ(deque.size_approx(), 96);
+    EXPECT_EQ(deque.capacity(), 128);
+}
+
+TEST(WorkStealingDequeTest, EveryItemTakenExactlyOnce) {
+    constexpr int count = 100000;
+    constexpr int thieves = 3;
+    WorkStealingDeque<int> deque(8);
+    std::vector<std::atomic<int>> taken(count);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t) {
+        threads.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire) || !deque.empty_approx()) {
+                if (auto item = deque.steal()) {
+                    taken[*item].fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Владелец чередует пачки push и pop, чтобы часто спорить с ворами за последний элемент
+    for (int next = 0; next < count;) {
+        for (int i = 0; i < 7 && next < count; ++i) deque.push(next++);
+        for (int i = 0; i < 3; ++i) {
+            if (auto item = deque.pop()) taken[*item].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    while (auto item = deque.pop()) taken[*item].fetch_add(1, std::memory_order_relaxed);
+    done.store(true, std::memory_order_release);
+    for (auto& thread : threads) thread.join();
+
+    for (int i = 0; i < count; ++i) ASSERT_EQ(taken[i].load(), 1) << i;
+}
+
+TEST(TaskSchedulerTest, ForkJoinRecursion) {
+    for (size_t threads : {1, 2, 4}) {
+        TaskScheduler scheduler(threads);
+        EXPECT_EQ(scheduler.size(), threads);
+        EXPECT_EQ(fib(scheduler, 25), 75025);
+
+        Vector<long long> v(100000);
+        std::iota(v.begin(), v.end(), 1LL);
+        EXPECT_EQ(sum(scheduler, v.data(), v.data() + v.size()), 100000LL * 100001 / 2);
+    }
+}
+
+TEST(TaskSchedulerTest, TaskGroupAndRun) {
+    TaskScheduler scheduler(3);
+    EXPECT_EQ(scheduler.run([] { return 7; }), 7);
+
+    std::vector<std::atomic<int>> hits(500);
+    scheduler.run([&] {
+        TaskGroup group(scheduler);
+        for (size_t i = 0; i < hits.size(); ++i) {
+            group.spawn([&, i] {
+                // Вложенная группа внутри задачи
+                TaskGroup inner(scheduler);
+                inner.spawn([&, i] { hits[i].fetch_add(1); });
+                inner.wait();
+                hits[i].fetch_add(1);
+            });
+        }
+        group.wait();
+    });
+    for (auto& h : hits) EXPECT_EQ(h.load(), 2);
+
+    TaskGroup outside(scheduler);
+    EXPECT_THROW(outside.spawn([] {}), std::logic_error);
+}
+
+TEST(TaskSchedulerTest, PropagatesException) {
+    TaskScheduler scheduler(4);
+    std::atomic<int> finished{0};
+    EXPECT_THROW(scheduler.run([&] {
+        TaskGroup group(scheduler);
+        for (int i = 0; i < 100; ++i) {
+            group.spawn([&, i] {
+                if (i == 42) throw std::runtime_error("task failed");
+                finished.fetch_add(1);
+            });
+        }
+        group.wait();
+    }),
+                 std::runtime_error);
+    EXPECT_EQ(finished.load(), 99);
+
+    // Исключение из a() в parallel_invoke дожидается b()
+    std::atomic<bool> b_done{false};
+    EXPECT_THROW(parallel_invoke(
+                     scheduler, [] { throw std::runtime_error("a failed"); }, [&] { b_done = true; }),
+                 std::runtime_error);
+    EXPECT_TRUE(b_done.load());
+    EXPECT_EQ(fib(scheduler, 20), 6765);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}